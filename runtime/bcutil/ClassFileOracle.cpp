@@ -1252,6 +1252,11 @@ ClassFileOracle::throwGenericErrorWithCustomMsg(UDATA code, UDATA offset)
 	if (NULL != errorMsg) {
 		_buildResult = GenericErrorCustomMsg;
 		buildError((J9CfrError*)errorMsg, code, GenericErrorCustomMsg, offset);
+		if (_context->isPrebuilding()) {
+			/* a prebuilt class is not being defined, the error is not reported */
+			j9mem_free_memory(errorMsg);
+			return;
+		}
 		J9TranslationBufferSet* dlb = _context->javaVM()->dynamicLoadBuffers;
 		/* avoid leaking memory if classFileError was not previously null. Do not free
 		 * memory if _classFileBuffer from ROMClassBuilder is using the same address. */
@@ -40,12 +40,14 @@
 #include "Cursor.hpp"
 #include "J9PortAllocationStrategy.hpp"
 #include "ROMClassCreationContext.hpp"
+#include "ROMClassPrebuilder.hpp"
 #include "ROMClassStringInternManager.hpp"
 #include "ROMClassSegmentAllocationStrategy.hpp"
 #include "ROMClassVerbosePhase.hpp"
 #include "ROMClassWriter.hpp"
 #include "SCStoreTransaction.hpp"
 #include "SCStringTransaction.hpp"
+#include "SHA256.hpp"
 #include "SRPKeyProducer.hpp"
 #include "SuppliedBufferAllocationStrategy.hpp"
 #include "WritingCursor.hpp"
@@ -55,6 +57,39 @@
 static const UDATA INITIAL_CLASS_FILE_BUFFER_SIZE = 4096;
 static const UDATA INITIAL_BUFFER_MANAGER_SIZE = 32768 * 10;
 
+#if defined(J9VM_OPT_SHARED_CLASSES)
+/* class name, '@' and the hash in hex */
+#define CLASS_FILE_HASH_KEY_MAX_LENGTH 512
+
+/* ROMClassBuilder::ClassFileHashRecord contextFlags */
+#define CLASS_FILE_HASH_BOOTSTRAP_LOADER 0x1
+#define CLASS_FILE_HASH_CLASS_UNMODIFIABLE 0x2
+#define CLASS_FILE_HASH_CONTENDED_FIELDS 0x4
+#define CLASS_FILE_HASH_APPLICATION_CONTENDED_FIELDS 0x8
+
+/* 64-bit FNV-1a, only used to build the shared data key: a record is accepted by comparing SHA-256 digests */
+static U_64
+hashBytes(U_64 hash, const U_8 *bytes, UDATA length)
+{
+	for (UDATA i = 0; i < length; i++) {
+		hash ^= (U_64)bytes[i];
+		hash *= J9CONST64(0x100000001b3);
+	}
+	return hash;
+}
+
+/* the first 64 bits of a digest, for tracing */
+static U_64
+digestPrefix(const U_8 *digest)
+{
+	U_64 prefix = 0;
+	for (UDATA i = 0; i < sizeof(prefix); i++) {
+		prefix = (prefix << 8) | (U_64)digest[i];
+	}
+	return prefix;
+}
+#endif /* J9VM_OPT_SHARED_CLASSES */
+
 ROMClassBuilder::ROMClassBuilder(J9JavaVM *javaVM, J9PortLibrary *portLibrary, UDATA maxStringInternTableSize, U_8 * verifyExcludeAttribute, VerifyClassFunction verifyClassFunction) :
 	_javaVM(javaVM),
 	_portLibrary(portLibrary),
@@ -66,7 +101,10 @@ ROMClassBuilder::ROMClassBuilder(J9JavaVM *javaVM, J9PortLibrary *portLibrary, U
 	_bufferManagerBuffer(NULL),
 	_anonClassNameBuffer(NULL),
 	_anonClassNameBufferSize(0),
-	_stringInternTable(javaVM, portLibrary, maxStringInternTableSize)
+	_stringInternTable(javaVM, portLibrary, maxStringInternTableSize),
+	_classFileHashLookupCount(0),
+	_classFileHashAcceptedCount(0),
+	_classFileHashRecordedCount(0)
 {
 }
 
@@ -119,6 +157,7 @@ shutdownROMClassBuilder(J9JavaVM *vm)
 	ROMClassBuilder *romClassBuilder = (ROMClassBuilder *)vm->dynamicLoadBuffers->romClassBuilder;
 	if ( NULL != romClassBuilder ) {
 		vm->dynamicLoadBuffers->romClassBuilder = NULL;
+		romClassBuilder->reportClassFileHashStatistics();
 		romClassBuilder->~ROMClassBuilder();
 		j9mem_free_memory(romClassBuilder);
 	}
@@ -187,7 +226,22 @@ j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDA
 			loadData->className, loadData->classNameLength, loadData->hostPackageName, loadData->hostPackageLength, intermediateData, (U_32) intermediateDataLength, loadData->romClass, loadData->classBeingRedefined,
 			loadData->classLoader, (0 != classFileBytesReplaced), (TRUE == isIntermediateROMClass), localBuffer);
 
-	BuildResult result = romClassBuilder->buildROMClass(&context);
+	BuildResult result = OK;
+	ROMClassPrebuilder *romClassPrebuilder = (ROMClassPrebuilder *)javaVM->dynamicLoadBuffers->romClassPrebuilder;
+	J9ROMClass *prebuiltROMClass = NULL;
+	if ((NULL != romClassPrebuilder)
+		&& (NULL == intermediateData)
+		&& (0 == classFileBytesReplaced)
+		&& (TRUE != isIntermediateROMClass)
+		&& romClassPrebuilder->isPrebuildCandidate(loadData)
+	) {
+		prebuiltROMClass = romClassPrebuilder->copyPrebuiltROMClass(loadData, bctFlags, &romClassSegmentAllocationStrategy);
+	}
+	if (NULL != prebuiltROMClass) {
+		context.recordROMClass(prebuiltROMClass);
+	} else {
+		result = romClassBuilder->buildROMClass(&context);
+	}
 	loadData->romClass = context.romClass();
 	context.reportStatistics(localBuffer);
 
@@ -214,6 +268,27 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 
 	context->recordLoadStart();
 
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	/*
+	 * If these class file bytes were defined before, the shared ROMClass used for them is found by
+	 * the SHA-256 digest of the bytes, avoiding parsing the class and comparing it to the shared ROMClasses.
+	 * The parser, the verifier and the comparison are all skipped, so the digest has to be one for which
+	 * a different class file with the same digest cannot be constructed.
+	 */
+	bool storeClassFileHash = false;
+	U_8 classFileDigest[SHA256::DIGEST_LENGTH];
+	if (isClassFileHashLookupAllowed(context)) {
+		SHA256::digest(context->classFileBytes(), context->classFileSize(), classFileDigest);
+		_classFileHashLookupCount += 1;
+		if (findSharedROMClassByClassFileHash(context, classFileDigest)) {
+			_classFileHashAcceptedCount += 1;
+			context->recordLoadEnd(result);
+			return result;
+		}
+		storeClassFileHash = true;
+	}
+#endif /* J9VM_OPT_SHARED_CLASSES */
+
 	context->recordParseClassFileStart();
 	ClassFileParser classFileParser(_portLibrary, _verifyClassFunction);
 	result = classFileParser.parseClassFile(context, &_classFileParserBufferSize, &_classFileBuffer);
@@ -243,12 +318,196 @@ ROMClassBuilder::buildROMClass(ROMClassCreationContext *context)
 	}
 	if ( OK == result ) {
 		context->recordTranslationEnd();
+#if defined(J9VM_OPT_SHARED_CLASSES)
+		if (storeClassFileHash) {
+			storeClassFileHashRecord(context, classFileDigest);
+		}
+#endif /* J9VM_OPT_SHARED_CLASSES */
 	}
 
 	context->recordLoadEnd(result);
 	return result;
 }
 
+void
+ROMClassBuilder::reportClassFileHashStatistics()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	if (0 != _classFileHashLookupCount) {
+		Trc_BCU_ROMClassBuilder_classFileHashStatistics(_classFileHashLookupCount, _classFileHashAcceptedCount, _classFileHashRecordedCount);
+		if ((NULL != _javaVM) && J9_ARE_ANY_BITS_SET(_javaVM->verboseLevel, VERBOSE_DYNLOAD)) {
+			j9tty_printf(PORTLIB, "<Shared ROMClass lookup by class file hash: %zu lookups, %zu accepted, %zu hashes stored>\n",
+				_classFileHashLookupCount, _classFileHashAcceptedCount, _classFileHashRecordedCount);
+		}
+	}
+}
+
+#if defined(J9VM_OPT_SHARED_CLASSES)
+bool
+ROMClassBuilder::isClassFileHashLookupAllowed(ROMClassCreationContext *context)
+{
+	/*
+	 * The hash of the class file bytes only identifies the ROMClass when nothing else it depends on
+	 * can differ between definitions, see getClassFileHashContextFlags() for the rest.
+	 */
+	return (NULL != _javaVM)
+		&& (NULL != context->className())
+		&& !context->shouldCompareROMClassForEquality()
+		&& context->isROMClassShareable()
+		&& !context->isSharedClassesBCIEnabled()
+		&& !context->isRedefining()
+		&& !context->isRetransforming()
+		&& !context->isRetransformAllowed()
+		&& !context->isClassAnon()
+		&& !context->isClassHidden()
+		&& !context->isClassUnsafe()
+		&& !context->classFileBytesReplaced()
+		&& !context->isCreatingIntermediateROMClass()
+		&& (NULL == context->intermediateClassData());
+}
+
+UDATA
+ROMClassBuilder::getClassFileHashContextFlags(ROMClassCreationContext *context)
+{
+	UDATA contextFlags = 0;
+
+	if (context->isBootstrapLoader()) {
+		contextFlags |= CLASS_FILE_HASH_BOOTSTRAP_LOADER;
+	}
+	if (context->isClassUnmodifiable()) {
+		contextFlags |= CLASS_FILE_HASH_CLASS_UNMODIFIABLE;
+	}
+	if (J9_ARE_ALL_BITS_SET(_javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_ALLOW_CONTENDED_FIELDS)) {
+		contextFlags |= CLASS_FILE_HASH_CONTENDED_FIELDS;
+	}
+	if (J9_ARE_ALL_BITS_SET(_javaVM->extendedRuntimeFlags, J9_EXTENDED_RUNTIME_ALLOW_APPLICATION_CONTENDED_FIELDS)) {
+		contextFlags |= CLASS_FILE_HASH_APPLICATION_CONTENDED_FIELDS;
+	}
+	return contextFlags;
+}
+
+UDATA
+ROMClassBuilder::getClassFileHashKey(ROMClassCreationContext *context, const U_8 *classFileDigest, UDATA contextFlags, char *keyBuffer, UDATA keyBufferSize)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	UDATA keyLength = 0;
+
+	/* one record is kept per class file and translation context */
+	UDATA bctFlags = context->bctFlags();
+	U_64 keyHash = hashBytes(J9CONST64(0xcbf29ce484222325), classFileDigest, SHA256::DIGEST_LENGTH);
+	keyHash = hashBytes(keyHash, (U_8 *)&bctFlags, sizeof(bctFlags));
+	keyHash = hashBytes(keyHash, (U_8 *)&contextFlags, sizeof(contextFlags));
+	keyHash = hashBytes(keyHash, (U_8 *)&_javaVM->romMethodSortThreshold, sizeof(_javaVM->romMethodSortThreshold));
+
+	/* '@', 16 hex digits and the NUL */
+	if ((context->classNameLength() + 18) <= keyBufferSize) {
+		keyLength = j9str_printf(PORTLIB, keyBuffer, keyBufferSize, "%.*s@%016llx",
+				(U_32)context->classNameLength(), context->className(), keyHash);
+	}
+	return keyLength;
+}
+
+bool
+ROMClassBuilder::findSharedROMClassByClassFileHash(ROMClassCreationContext *context, const U_8 *classFileDigest)
+{
+	ROMClassVerbosePhase v(context, CompareSharedROMClass);
+	J9VMThread *currentThread = context->currentVMThread();
+	UDATA contextFlags = getClassFileHashContextFlags(context);
+	char key[CLASS_FILE_HASH_KEY_MAX_LENGTH];
+	UDATA keyLength = getClassFileHashKey(context, classFileDigest, contextFlags, key, sizeof(key));
+	J9SharedDataDescriptor descriptor;
+	bool found = false;
+
+	if ((0 != keyLength)
+		&& (0 < _javaVM->sharedClassConfig->findSharedData(currentThread, key, keyLength, J9SHR_DATA_TYPE_VM, FALSE, &descriptor, NULL))
+		&& (sizeof(ClassFileHashRecord) == descriptor.length)
+	) {
+		ClassFileHashRecord record;
+		memcpy(&record, descriptor.address, sizeof(record));
+
+		if ((0 == memcmp(record.classFileDigest, classFileDigest, SHA256::DIGEST_LENGTH))
+			&& (record.classFileSize == context->classFileSize())
+			&& (record.bctFlags == context->bctFlags())
+			&& (record.romMethodSortThreshold == _javaVM->romMethodSortThreshold)
+			&& (record.contextFlags == contextFlags)
+		) {
+			UDATA loadType = (LOAD_LOCATION_UNKNOWN == context->loadLocation()) ? J9SHR_LOADTYPE_NOT_FROM_PATH : J9SHR_LOADTYPE_NORMAL;
+			/*
+			 * The ROMClass is found through a store transaction, as when it is found by comparison,
+			 * so that the transaction records it for this class path entry.
+			 */
+			SCStoreTransaction sharedStoreClassTransaction =
+					SCStoreTransaction(currentThread,
+									   context->classLoader(),
+									   context->cpIndex(),
+									   loadType,
+									   (U_16)context->classNameLength(), context->className(),
+									   false,
+									   false);
+
+			if (sharedStoreClassTransaction.isOK()) {
+				for (
+					J9ROMClass *existingROMClass = sharedStoreClassTransaction.nextSharedClassForCompare();
+					NULL != existingROMClass;
+					existingROMClass = sharedStoreClassTransaction.nextSharedClassForCompare()
+				) {
+					if (existingROMClass->romSize == record.romSize) {
+						U_8 romClassDigest[SHA256::DIGEST_LENGTH];
+						SHA256::digest((U_8 *)existingROMClass, existingROMClass->romSize, romClassDigest);
+						if (0 == memcmp(record.romClassDigest, romClassDigest, SHA256::DIGEST_LENGTH)) {
+							context->recordROMClass(existingROMClass);
+							found = true;
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+	Trc_BCU_ROMClassBuilder_findSharedROMClassByClassFileHash((U_32)context->classNameLength(), context->className(), digestPrefix(classFileDigest), (UDATA)(found ? 1 : 0));
+	return found;
+}
+
+void
+ROMClassBuilder::storeClassFileHashRecord(ROMClassCreationContext *context, const U_8 *classFileDigest)
+{
+	J9ROMClass *romClass = context->romClass();
+
+	/* only ROMClasses stored in or found in the shared cache are recorded */
+	if ((NULL != romClass)
+		&& j9shr_Query_IsAddressInCache(_javaVM, romClass, romClass->romSize)
+		&& !context->isSharedClassesCacheFull()
+	) {
+		UDATA contextFlags = getClassFileHashContextFlags(context);
+		char key[CLASS_FILE_HASH_KEY_MAX_LENGTH];
+		UDATA keyLength = getClassFileHashKey(context, classFileDigest, contextFlags, key, sizeof(key));
+
+		if (0 != keyLength) {
+			ClassFileHashRecord record;
+			J9SharedDataDescriptor descriptor;
+
+			memset(&record, 0, sizeof(record));
+			memcpy(record.classFileDigest, classFileDigest, SHA256::DIGEST_LENGTH);
+			SHA256::digest((U_8 *)romClass, romClass->romSize, record.romClassDigest);
+			record.classFileSize = (U_32)context->classFileSize();
+			record.romSize = romClass->romSize;
+			record.bctFlags = context->bctFlags();
+			record.romMethodSortThreshold = _javaVM->romMethodSortThreshold;
+			record.contextFlags = contextFlags;
+
+			descriptor.address = (U_8 *)&record;
+			descriptor.length = sizeof(record);
+			descriptor.type = J9SHR_DATA_TYPE_VM;
+			descriptor.flags = 0;
+			if (NULL != _javaVM->sharedClassConfig->storeSharedData(context->currentVMThread(), key, keyLength, &descriptor)) {
+				_classFileHashRecordedCount += 1;
+			}
+		}
+	}
+}
+#endif /* J9VM_OPT_SHARED_CLASSES */
+
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 BuildResult
 ROMClassBuilder::injectInterfaces(ClassFileOracle *classFileOracle)
@@ -835,7 +1094,7 @@ ROMClassBuilder::prepareAndLaydown( BufferManager *bufferManager, ClassFileParse
 	}
 
 #if defined(J9VM_OPT_SHARED_CLASSES)
-	if (NULL != context->javaVM()) {
+	if ((NULL != context->javaVM()) && !context->isPrebuilding()) {
 		SCStringTransaction scStringTransaction = SCStringTransaction(context->currentVMThread());
 		romSize = finishPrepareAndLaydown(romClassBuffer, lineNumberBuffer, variableInfoBuffer, &sizeInformation, modifiers, extraModifiers, optionalFlags,
 				false, scStringTransaction.isOK(), &classFileOracle, &srpOffsetTable, &srpKeyProducer, &romClassWriter, context, &constantPoolMap);
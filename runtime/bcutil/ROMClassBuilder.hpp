@@ -35,6 +35,7 @@
 
 #include "BuildResult.hpp"
 #include "ClassFileParser.hpp"  /* included to obtain definition of VerifyClassFunction */
+#include "SHA256.hpp"
 #include "StringInternTable.hpp"
 
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
@@ -73,6 +74,12 @@ public:
 
 	BuildResult buildROMClass(ROMClassCreationContext *context);
 
+	/**
+	 * Report the number of shared ROMClasses found by class file hash, on the
+	 * -verbose:dynload output if enabled and in a tracepoint.
+	 */
+	void reportClassFileHashStatistics();
+
 protected:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
 
@@ -114,6 +121,24 @@ private:
 		UDATA rawClassDataSize;
 	};
 
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	/*
+	 * Stored in the shared cache (as VM byte data keyed by the class name and a hash of the class file digest) when a ROMClass
+	 * built or found by comparison in the cache is used for a class file, so that the next definition
+	 * of the same class file bytes can use the shared ROMClass without parsing and comparing the class.
+	 */
+	struct ClassFileHashRecord
+	{
+		U_8 classFileDigest[SHA256::DIGEST_LENGTH];
+		U_8 romClassDigest[SHA256::DIGEST_LENGTH];
+		U_32 classFileSize;
+		U_32 romSize;
+		UDATA bctFlags;
+		UDATA romMethodSortThreshold;
+		UDATA contextFlags;
+	};
+#endif /* J9VM_OPT_SHARED_CLASSES */
+
 	/* NOTE: Be sure to update J9DbgROMClassBuilder in j9nonbuilder.h when changing the state variables below. */
 	J9JavaVM *_javaVM;
 	J9PortLibrary * _portLibrary;
@@ -126,6 +151,9 @@ private:
 	UDATA _anonClassNameBufferSize;
 	U_8 *_bufferManagerBuffer;
 	StringInternTable _stringInternTable;
+	UDATA _classFileHashLookupCount;
+	UDATA _classFileHashAcceptedCount;
+	UDATA _classFileHashRecordedCount;
 #if defined(J9VM_OPT_VALHALLA_VALUE_TYPES)
 	InterfaceInjectionInfo _interfaceInjectionInfo;
 #endif /* J9VM_OPT_VALHALLA_VALUE_TYPES */
@@ -137,6 +165,13 @@ private:
 	U_32 computeExtraModifiers(ClassFileOracle *classFileOracle, ROMClassCreationContext *context);
 	U_32 computeOptionalFlags(ClassFileOracle *classFileOracle, ROMClassCreationContext *context);
 	BuildResult prepareAndLaydown( BufferManager *bufferManager, ClassFileParser *classFileParser, ROMClassCreationContext *context );
+#if defined(J9VM_OPT_SHARED_CLASSES)
+	bool isClassFileHashLookupAllowed(ROMClassCreationContext *context);
+	UDATA getClassFileHashContextFlags(ROMClassCreationContext *context);
+	UDATA getClassFileHashKey(ROMClassCreationContext *context, const U_8 *classFileDigest, UDATA contextFlags, char *keyBuffer, UDATA keyBufferSize);
+	bool findSharedROMClassByClassFileHash(ROMClassCreationContext *context, const U_8 *classFileDigest);
+	void storeClassFileHashRecord(ROMClassCreationContext *context, const U_8 *classFileDigest);
+#endif /* J9VM_OPT_SHARED_CLASSES */
 	void checkDebugInfoCompression(J9ROMClass *romClass, ClassFileOracle classFileOracle, SRPKeyProducer *srpKeyProducer, ConstantPoolMap *constantPoolMap, SRPOffsetTable *srpOffsetTable);
 	U_32 finishPrepareAndLaydown(
 			U_8 *romClassBuffer,
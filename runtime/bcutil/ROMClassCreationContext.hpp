@@ -74,6 +74,7 @@ public:
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(false),
+		_prebuilding(false),
 		_patchMap(NULL)
 	{
 	}
@@ -113,6 +114,7 @@ public:
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(false),
+		_prebuilding(false),
 		_patchMap(NULL)
 	{
 	}
@@ -159,6 +161,7 @@ public:
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(creatingIntermediateROMClass),
+		_prebuilding(false),
 		_patchMap(NULL)
 	{
 		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
@@ -178,7 +181,57 @@ public:
 		}
 	}
 
+	/*
+	 * Context for building a ROMClass ahead of its definition by the bootstrap loader (see ROMClassPrebuilder).
+	 * The ROMClass must only depend on the class file bytes and the translation flags, so it is built
+	 * without string interning, the shared cache or the VM's dynamic load buffers.
+	 */
+	ROMClassCreationContext(J9PortLibrary *portLibrary, J9JavaVM *javaVM, U_8 *classFileBytes, UDATA classFileSize, UDATA bctFlags, AllocationStrategy *allocationStrategy) :
+		_portLibrary(portLibrary),
+		_javaVM(javaVM),
+		_classFileBytes(classFileBytes),
+		_classFileSize(classFileSize),
+		_bctFlags(bctFlags),
+		_bcuFlags(0),
+		_findClassFlags(0),
+		_allocationStrategy(allocationStrategy),
+		_romClass(NULL),
+		_clazz(NULL),
+		_className(NULL),
+		_classNameLength(0),
+		_hostPackageName(NULL),
+		_hostPackageLength(0),
+		_intermediateClassData(NULL),
+		_intermediateClassDataLength(0),
+		_classLoader(javaVM->systemClassLoader),
+		_cpIndex(0),
+		_loadLocation(0),
+		_dynamicLoadStats(NULL),
+		_sharedStringInternTable(NULL),
+		_classFileBytesReplaced(false),
+#if defined(J9VM_OPT_JVMTI)
+		_retransformAllowed(0 != (javaVM->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_ALLOW_RETRANSFORM)),
+#else
+		_retransformAllowed(false),
+#endif
+		_interningEnabled(false),
+		_verboseROMClass(false),
+		_verboseLastBufferSizeExceeded(0),
+		_verboseOutOfMemoryCount(0),
+		_verboseCurrentPhase(ROMClassCreation),
+		_buildResult(OK),
+		_forceDebugDataInLine(false),
+		_doDebugCompare(false),
+		_existingRomMethod(NULL),
+		_reusingIntermediateClassData(false),
+		_creatingIntermediateROMClass(false),
+		_prebuilding(true),
+		_patchMap(NULL)
+	{
+	}
+
 	bool isCreatingIntermediateROMClass() const { return _creatingIntermediateROMClass; }
+	bool isPrebuilding() const { return _prebuilding; }
 	U_8 *classFileBytes() const { return _classFileBytes; }
 	UDATA classFileSize() const { return _classFileSize; }
 	UDATA findClassFlags() const {return _findClassFlags; }
@@ -216,8 +269,8 @@ public:
 	bool isRedefining() const { return J9_FINDCLASS_FLAG_REDEFINING == (_findClassFlags & J9_FINDCLASS_FLAG_REDEFINING); }
 	bool isRetransforming() const { return J9_FINDCLASS_FLAG_RETRANSFORMING == (_findClassFlags & J9_FINDCLASS_FLAG_RETRANSFORMING); }
 	bool isClassLoaderSharedClassesEnabled() const { return NULL != _classLoader && (_classLoader->flags & J9CLASSLOADER_SHARED_CLASSES_ENABLED); }
-	bool isSharedClassesEnabled() const { return (NULL != _javaVM) && (NULL != _javaVM->sharedClassConfig); }
-	bool isSharedClassesCacheFull() const { return (NULL != _javaVM) && j9shr_Query_IsCacheFull(_javaVM); }
+	bool isSharedClassesEnabled() const { return (NULL != _javaVM) && !_prebuilding && (NULL != _javaVM->sharedClassConfig); }
+	bool isSharedClassesCacheFull() const { return (NULL != _javaVM) && !_prebuilding && j9shr_Query_IsCacheFull(_javaVM); }
 
 	/* Note: Always call isSharedClassesEnabled() before using isSharedClassesBCIEnabled() */
 	bool isSharedClassesBCIEnabled() const { return (0 != _javaVM->sharedClassConfig->isBCIEnabled(_javaVM)); }
@@ -547,7 +600,8 @@ public:
 
 	void recordCFRError(U_8 *cfrError)
 	{
-		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
+		/* a prebuilt class is not being defined, the error is not reported */
+		if ((NULL != _javaVM) && !_prebuilding && (NULL != _javaVM->dynamicLoadBuffers)) {
 			_javaVM->dynamicLoadBuffers->classFileError = cfrError;
 		}
 	}
@@ -559,7 +613,7 @@ public:
 		 * into _javaVM->dynamicLoadBuffers->classFileError, if the internal buffer that is free'd matches the one in
 		 * _javaVM->dynamicLoadBuffers->classFileError, then it must be set to NULL to avoid a double free in
 		 * j9bcutil_freeTranslationBuffers()*/
-		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers) && (buffer == _javaVM->dynamicLoadBuffers->classFileError)) {
+		if ((NULL != _javaVM) && !_prebuilding && (NULL != _javaVM->dynamicLoadBuffers) && (buffer == _javaVM->dynamicLoadBuffers->classFileError)) {
 			_javaVM->dynamicLoadBuffers->classFileError = NULL;
 		}
 		j9mem_free_memory(buffer);
@@ -807,6 +861,7 @@ private:
 	J9ROMMethod * _existingRomMethod;
 	bool _reusingIntermediateClassData;
 	bool _creatingIntermediateROMClass;
+	bool _prebuilding;
 	J9ClassPatchMap *_patchMap;
 
 	J9ROMMethod * romMethodFromOffset(IDATA offset);
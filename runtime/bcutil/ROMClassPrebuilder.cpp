@@ -0,0 +1,509 @@
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * ROMClassPrebuilder.cpp
+ */
+
+#include "ROMClassPrebuilder.hpp"
+
+#include "bcutil_api.h"
+#include "j9protos.h"
+#include "jvminit.h"
+#include "rommeth.h"
+#include "ut_j9bcu.h"
+#include "vmi.h"
+
+#include "AllocationStrategy.hpp"
+#include "J9PortAllocationStrategy.hpp"
+#include "ROMClassBuilder.hpp"
+#include "ROMClassCreationContext.hpp"
+
+/* upper bound of the memory held by prebuilt ROMClasses which have not been used yet */
+#define ROMCLASS_PREBUILD_MAX_BYTES (64 * 1024 * 1024)
+
+static const char classSuffix[] = ".class";
+static const char metaInfPrefix[] = "META-INF/";
+static const char moduleInfoName[] = "module-info.class";
+
+ROMClassPrebuilder::ROMClassPrebuilder(J9JavaVM *javaVM) :
+	_javaVM(javaVM),
+	_portLibrary(javaVM->portLibrary),
+	_monitor(NULL),
+	_prebuiltROMClasses(NULL),
+	_jarQueueHead(NULL),
+	_jarQueueTail(NULL),
+	_threadCount(0),
+	_shutdown(false),
+	_bctFlagsKnown(false),
+	_bctFlags(0),
+	_prebuiltBytes(0),
+	_prebuiltCount(0),
+	_usedCount(0),
+	_wastedCount(0),
+	_wastedBytes(0),
+	_failedCount(0),
+	_skippedCount(0),
+	_notPrebuiltCount(0)
+{
+}
+
+ROMClassPrebuilder *
+ROMClassPrebuilder::newInstance(J9JavaVM *javaVM, UDATA threadCount)
+{
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+	ROMClassPrebuilder *prebuilder = (ROMClassPrebuilder *)j9mem_allocate_memory(sizeof(ROMClassPrebuilder), J9MEM_CATEGORY_CLASSES);
+	if (NULL != prebuilder) {
+		new(prebuilder) ROMClassPrebuilder(javaVM);
+		if (!prebuilder->initialize(threadCount)) {
+			prebuilder->kill();
+			prebuilder = NULL;
+		}
+	}
+	return prebuilder;
+}
+
+void
+ROMClassPrebuilder::kill()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	tearDown();
+	j9mem_free_memory(this);
+}
+
+bool
+ROMClassPrebuilder::initialize(UDATA threadCount)
+{
+	if (0 != omrthread_monitor_init_with_name(&_monitor, 0, "ROMClass prebuilder")) {
+		return false;
+	}
+	_prebuiltROMClasses = hashTableNew(OMRPORT_FROM_J9PORT(_portLibrary), J9_GET_CALLSITE(), 0,
+			sizeof(PrebuiltROMClass), sizeof(char *), J9HASH_TABLE_ALLOW_SIZE_OPTIMIZATION,
+			J9MEM_CATEGORY_CLASSES, hashFn, hashEqualFn, NULL, NULL);
+	if (NULL == _prebuiltROMClasses) {
+		return false;
+	}
+
+	for (UDATA i = 0; i < threadCount; i++) {
+		omrthread_t thread = NULL;
+		omrthread_monitor_enter(_monitor);
+		_threadCount += 1;
+		omrthread_monitor_exit(_monitor);
+		if (0 != _javaVM->internalVMFunctions->createThreadWithCategory(&thread, _javaVM->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0,
+				prebuildThreadProc, this, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			omrthread_monitor_enter(_monitor);
+			_threadCount -= 1;
+			omrthread_monitor_exit(_monitor);
+			break;
+		}
+	}
+	return true;
+}
+
+void
+ROMClassPrebuilder::tearDown()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	if (NULL != _monitor) {
+		/* stop the prebuild threads, they exit after building the current class */
+		omrthread_monitor_enter(_monitor);
+		_shutdown = true;
+		omrthread_monitor_notify_all(_monitor);
+		while (0 != _threadCount) {
+			omrthread_monitor_wait(_monitor);
+		}
+		omrthread_monitor_exit(_monitor);
+	}
+
+	while (NULL != _jarQueueHead) {
+		PrebuildJar *jar = _jarQueueHead;
+		_jarQueueHead = jar->next;
+		j9mem_free_memory(jar);
+	}
+	_jarQueueTail = NULL;
+
+	if (NULL != _prebuiltROMClasses) {
+		J9HashTableState walkState;
+		PrebuiltROMClass *entry = (PrebuiltROMClass *)hashTableStartDo(_prebuiltROMClasses, &walkState);
+		while (NULL != entry) {
+			/* never defined */
+			_wastedCount += 1;
+			_wastedBytes += entry->romClass->romSize;
+			freePrebuiltROMClass(entry);
+			entry = (PrebuiltROMClass *)hashTableNextDo(&walkState);
+		}
+		hashTableFree(_prebuiltROMClasses);
+		_prebuiltROMClasses = NULL;
+	}
+
+	if (NULL != _monitor) {
+		reportStatistics();
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+void
+ROMClassPrebuilder::prebuildJar(J9ClassPathEntry *cpEntry)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	/* classes of a shared classes enabled loader are found in the shared cache instead */
+	J9ClassLoader *systemClassLoader = _javaVM->systemClassLoader;
+	if ((NULL != systemClassLoader) && J9_ARE_ANY_BITS_SET(systemClassLoader->flags, J9CLASSLOADER_SHARED_CLASSES_ENABLED)) {
+		return;
+	}
+
+	PrebuildJar *jar = (PrebuildJar *)j9mem_allocate_memory(sizeof(PrebuildJar) + cpEntry->pathLength + 1, J9MEM_CATEGORY_CLASSES);
+	if (NULL != jar) {
+		jar->next = NULL;
+		jar->path = (char *)(jar + 1);
+		memcpy(jar->path, cpEntry->path, cpEntry->pathLength);
+		jar->path[cpEntry->pathLength] = '\0';
+
+		omrthread_monitor_enter(_monitor);
+		if (NULL == _jarQueueTail) {
+			_jarQueueHead = jar;
+		} else {
+			_jarQueueTail->next = jar;
+		}
+		_jarQueueTail = jar;
+		omrthread_monitor_notify(_monitor);
+		omrthread_monitor_exit(_monitor);
+	}
+}
+
+bool
+ROMClassPrebuilder::isPrebuildCandidate(J9LoadROMClassData *loadData)
+{
+	J9JavaVM *vm = _javaVM;
+
+	return (loadData->classLoader == vm->systemClassLoader)
+		&& J9_ARE_NO_BITS_SET(loadData->classLoader->flags, J9CLASSLOADER_SHARED_CLASSES_ENABLED)
+		&& J9_ARE_NO_BITS_SET(loadData->options, J9_FINDCLASS_FLAG_ANON | J9_FINDCLASS_FLAG_HIDDEN | J9_FINDCLASS_FLAG_UNSAFE
+				| J9_FINDCLASS_FLAG_REDEFINING | J9_FINDCLASS_FLAG_RETRANSFORMING | J9_FINDCLASS_FLAG_SHRC_ROMCLASS_EXISTS)
+		&& (NULL == loadData->romClass)
+		&& (NULL == loadData->classBeingRedefined)
+		&& (NULL != loadData->className)
+		/* the ROMClass of a class defined before java.lang.Object may be marked unmodifiable */
+		&& (NULL != J9VMJAVALANGOBJECT_OR_NULL(vm))
+		/* retransformation keeps the class file bytes after the ROMClass */
+		&& J9_ARE_NO_BITS_SET(vm->requiredDebugAttributes, J9VM_DEBUG_ATTRIBUTE_ALLOW_RETRANSFORM);
+}
+
+J9ROMClass *
+ROMClassPrebuilder::copyPrebuiltROMClass(J9LoadROMClassData *loadData, UDATA bctFlags, AllocationStrategy *allocationStrategy)
+{
+	PrebuiltROMClass query;
+	PrebuiltROMClass found;
+	J9ROMClass *romClass = NULL;
+	bool isFound = false;
+
+	memset(&query, 0, sizeof(query));
+	query.name = loadData->className;
+	query.nameLength = loadData->classNameLength;
+
+	omrthread_monitor_enter(_monitor);
+	/* the prebuild threads build with the flags of the most recent definition */
+	if (!_bctFlagsKnown || (_bctFlags != bctFlags)) {
+		_bctFlags = bctFlags;
+		_bctFlagsKnown = true;
+		omrthread_monitor_notify_all(_monitor);
+	}
+	PrebuiltROMClass *entry = (PrebuiltROMClass *)hashTableFind(_prebuiltROMClasses, &query);
+	if (NULL != entry) {
+		found = *entry;
+		hashTableRemove(_prebuiltROMClasses, entry);
+		_prebuiltBytes -= found.romClass->romSize + found.classDataLength;
+		isFound = true;
+	} else {
+		_notPrebuiltCount += 1;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	if (isFound) {
+		if ((found.bctFlags == bctFlags)
+			&& (found.romMethodSortThreshold == _javaVM->romMethodSortThreshold)
+			&& (found.classDataLength == loadData->classDataLength)
+			&& (0 == memcmp(found.classData, loadData->classData, found.classDataLength))
+		) {
+			/* the ROMClass is self-relative and does not refer to any memory outside of it */
+			U_32 romSize = found.romClass->romSize;
+			U_8 *romClassBuffer = allocationStrategy->allocate(romSize);
+			if (NULL != romClassBuffer) {
+				memcpy(romClassBuffer, found.romClass, romSize);
+				romClass = (J9ROMClass *)romClassBuffer;
+			}
+		}
+
+		omrthread_monitor_enter(_monitor);
+		if (NULL != romClass) {
+			_usedCount += 1;
+		} else {
+			/* defined from a different JAR or with different translation flags */
+			_wastedCount += 1;
+			_wastedBytes += found.romClass->romSize;
+		}
+		omrthread_monitor_exit(_monitor);
+		freePrebuiltROMClass(&found);
+	}
+
+	return romClass;
+}
+
+void
+ROMClassPrebuilder::reportStatistics()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+
+	omrthread_monitor_enter(_monitor);
+	Trc_BCU_ROMClassPrebuilder_statistics(_prebuiltCount, _usedCount, _wastedCount, _wastedBytes, _failedCount, _skippedCount, _notPrebuiltCount);
+	if (J9_ARE_ANY_BITS_SET(_javaVM->verboseLevel, VERBOSE_DYNLOAD)) {
+		j9tty_printf(PORTLIB,
+			"<ROMClass prebuild: %zu prebuilt, %zu used, %zu wasted (%zu bytes)>\n<  %zu failed, %zu skipped, %zu bootstrap classes not prebuilt>\n",
+			_prebuiltCount, _usedCount, _wastedCount, _wastedBytes, _failedCount, _skippedCount, _notPrebuiltCount);
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+ROMClassPrebuilder::prebuildThreadProc(void *entryArg)
+{
+	ROMClassPrebuilder *prebuilder = (ROMClassPrebuilder *)entryArg;
+
+	prebuilder->prebuildThreadLoop();
+
+	omrthread_monitor_enter(prebuilder->_monitor);
+	prebuilder->_threadCount -= 1;
+	omrthread_monitor_notify_all(prebuilder->_monitor);
+	omrthread_exit(prebuilder->_monitor);
+	return 0;
+}
+
+void
+ROMClassPrebuilder::prebuildThreadLoop()
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	J9BytecodeVerificationData *verifyBuffers = _javaVM->bytecodeVerificationData;
+	/* each thread has its own builder as the builder buffers are not thread safe */
+	ROMClassBuilder romClassBuilder(NULL, PORTLIB, 0,
+			(NULL == verifyBuffers) ? NULL : verifyBuffers->excludeAttribute,
+			(NULL == verifyBuffers) ? NULL : j9bcv_verifyClassStructure);
+
+	omrthread_monitor_enter(_monitor);
+	while (!_shutdown) {
+		/* nothing is built until the translation flags are known from the first bootstrap class definition */
+		if (_bctFlagsKnown && (NULL != _jarQueueHead)) {
+			PrebuildJar *jar = _jarQueueHead;
+			UDATA bctFlags = _bctFlags;
+			_jarQueueHead = jar->next;
+			if (NULL == _jarQueueHead) {
+				_jarQueueTail = NULL;
+			}
+			omrthread_monitor_exit(_monitor);
+
+			prebuildClasses(&romClassBuilder, jar->path, bctFlags);
+			j9mem_free_memory(jar);
+
+			omrthread_monitor_enter(_monitor);
+		} else {
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+void
+ROMClassPrebuilder::prebuildClasses(ROMClassBuilder *romClassBuilder, const char *path, UDATA bctFlags)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	VMI_ACCESS_FROM_JAVAVM((JavaVM *)_javaVM);
+	VMIZipFunctionTable *zipFunctions = (*VMI)->GetZipFunctions(VMI);
+	VMIZipFile zipFile;
+	VMIZipEntry entry;
+	IDATA nextEntryPointer = 0;
+
+	Trc_BCU_ROMClassPrebuilder_prebuildClasses(path);
+
+	/* the class path entry is used by the class loader, read the JAR through a separate handle */
+	memset(&zipFile, 0, sizeof(zipFile));
+	if (0 != zipFunctions->zip_openZipFile(VMI, (char *)path, &zipFile, 0)) {
+		return;
+	}
+	zipFunctions->zip_resetZipFile(VMI, &zipFile, &nextEntryPointer);
+	zipFunctions->zip_initZipEntry(VMI, &entry);
+	while (!_shutdown
+		&& (0 == zipFunctions->zip_getNextZipEntry(VMI, &zipFile, &entry, &nextEntryPointer, ZIP_FLAG_READ_DATA_POINTER))
+	) {
+		UDATA nameLength = entry.filenameLength;
+		const char *name = (const char *)entry.filename;
+
+		if ((nameLength > LITERAL_STRLEN(classSuffix))
+			&& (0 == memcmp(name + nameLength - LITERAL_STRLEN(classSuffix), classSuffix, LITERAL_STRLEN(classSuffix)))
+			&& !((nameLength >= LITERAL_STRLEN(metaInfPrefix)) && (0 == memcmp(name, metaInfPrefix, LITERAL_STRLEN(metaInfPrefix))))
+			&& !((nameLength == LITERAL_STRLEN(moduleInfoName)) && (0 == memcmp(name, moduleInfoName, LITERAL_STRLEN(moduleInfoName))))
+		) {
+			UDATA classDataLength = entry.uncompressedSize;
+			U_8 *classData = (U_8 *)j9mem_allocate_memory(classDataLength, J9MEM_CATEGORY_CLASSES);
+			if (NULL != classData) {
+				if (0 == zipFunctions->zip_getZipEntryData(VMI, &zipFile, &entry, classData, (U_32)classDataLength)) {
+					/* prebuildClass() takes ownership of classData */
+					prebuildClass(romClassBuilder, path, classData, classDataLength, bctFlags);
+				} else {
+					j9mem_free_memory(classData);
+				}
+			}
+		}
+		zipFunctions->zip_freeZipEntry(VMI, &entry);
+	}
+	zipFunctions->zip_closeZipFile(VMI, &zipFile);
+}
+
+void
+ROMClassPrebuilder::prebuildClass(ROMClassBuilder *romClassBuilder, const char *path, U_8 *classData, UDATA classDataLength, UDATA bctFlags)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	bool isAdded = false;
+
+	omrthread_monitor_enter(_monitor);
+	bool isOverBudget = ((_prebuiltBytes + classDataLength) > ROMCLASS_PREBUILD_MAX_BYTES);
+	if (isOverBudget) {
+		_skippedCount += 1;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	if (!isOverBudget) {
+		J9PortAllocationStrategy allocationStrategy(PORTLIB);
+		ROMClassCreationContext context(PORTLIB, _javaVM, classData, classDataLength, bctFlags, &allocationStrategy);
+		BuildResult result = romClassBuilder->buildROMClass(&context);
+		J9ROMClass *romClass = context.romClass();
+
+		if ((OK == result) && (NULL != romClass)) {
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(romClass);
+			PrebuiltROMClass newEntry;
+
+			newEntry.name = J9UTF8_DATA(className);
+			newEntry.nameLength = J9UTF8_LENGTH(className);
+			newEntry.romClass = romClass;
+			newEntry.classData = classData;
+			newEntry.classDataLength = classDataLength;
+			newEntry.bctFlags = bctFlags;
+			newEntry.romMethodSortThreshold = _javaVM->romMethodSortThreshold;
+
+			omrthread_monitor_enter(_monitor);
+			PrebuiltROMClass *entry = (PrebuiltROMClass *)hashTableAdd(_prebuiltROMClasses, &newEntry);
+			if ((NULL != entry) && (entry->romClass == romClass)) {
+				_prebuiltCount += 1;
+				_prebuiltBytes += romClass->romSize + classDataLength;
+				isAdded = true;
+			} else {
+				/* the class is also in another JAR (or there is no memory for the table entry) */
+				_wastedCount += 1;
+				_wastedBytes += romClass->romSize;
+			}
+			omrthread_monitor_exit(_monitor);
+
+			if (!isAdded) {
+				j9mem_free_memory(romClass);
+			}
+		} else {
+			Trc_BCU_ROMClassPrebuilder_prebuildClassFailed(path, (IDATA)result);
+			omrthread_monitor_enter(_monitor);
+			_failedCount += 1;
+			omrthread_monitor_exit(_monitor);
+			j9mem_free_memory(romClass);
+		}
+	}
+
+	if (!isAdded) {
+		j9mem_free_memory(classData);
+	}
+}
+
+void
+ROMClassPrebuilder::freePrebuiltROMClass(PrebuiltROMClass *entry)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	j9mem_free_memory(entry->romClass);
+	j9mem_free_memory(entry->classData);
+}
+
+UDATA
+ROMClassPrebuilder::hashFn(void *key, void *userData)
+{
+	PrebuiltROMClass *entry = (PrebuiltROMClass *)key;
+	UDATA hash = 0;
+
+	for (UDATA i = 0; i < entry->nameLength; ++i) {
+		hash = (hash << 5) - hash + entry->name[i];
+	}
+	return hash;
+}
+
+UDATA
+ROMClassPrebuilder::hashEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	PrebuiltROMClass *left = (PrebuiltROMClass *)leftKey;
+	PrebuiltROMClass *right = (PrebuiltROMClass *)rightKey;
+
+	return J9UTF8_DATA_EQUALS(left->name, left->nameLength, right->name, right->nameLength);
+}
+
+extern "C" IDATA
+startupROMClassPrebuilder(J9JavaVM *vm, UDATA threadCount)
+{
+	IDATA rc = 0;
+
+	if (0 != threadCount) {
+		ROMClassPrebuilder *prebuilder = ROMClassPrebuilder::newInstance(vm, threadCount);
+		if (NULL == prebuilder) {
+			rc = -1;
+		} else {
+			vm->dynamicLoadBuffers->romClassPrebuilder = prebuilder;
+			vm->dynamicLoadBuffers->prebuildROMClassesFunction = j9bcutil_prebuildROMClasses;
+		}
+	}
+	return rc;
+}
+
+extern "C" void
+shutdownROMClassPrebuilder(J9JavaVM *vm)
+{
+	ROMClassPrebuilder *prebuilder = (ROMClassPrebuilder *)vm->dynamicLoadBuffers->romClassPrebuilder;
+	if (NULL != prebuilder) {
+		vm->dynamicLoadBuffers->prebuildROMClassesFunction = NULL;
+		vm->dynamicLoadBuffers->romClassPrebuilder = NULL;
+		prebuilder->kill();
+	}
+}
+
+extern "C" void
+j9bcutil_prebuildROMClasses(J9JavaVM *javaVM, J9ClassPathEntry *cpEntry)
+{
+	ROMClassPrebuilder *prebuilder = (ROMClassPrebuilder *)javaVM->dynamicLoadBuffers->romClassPrebuilder;
+	if ((NULL != prebuilder) && (CPE_TYPE_JAR == cpEntry->type)) {
+		prebuilder->prebuildJar(cpEntry);
+	}
+}
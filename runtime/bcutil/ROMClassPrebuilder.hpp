@@ -0,0 +1,138 @@
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * ROMClassPrebuilder.hpp
+ */
+
+#ifndef ROMCLASSPREBUILDER_HPP_
+#define ROMCLASSPREBUILDER_HPP_
+
+/* @ddr_namespace: default */
+#include "j9comp.h"
+#include "j9.h"
+
+class AllocationStrategy;
+class ROMClassBuilder;
+
+/*
+ * Builds the ROMClasses of the classes in bootstrap class path JARs on background threads
+ * when the JAR is opened, so that defining one of these classes only has to copy the ROMClass
+ * into the class loader's memory segment.
+ *
+ * The ROMClasses are built into memory owned by the prebuilder and must not depend on anything
+ * but the class file bytes and the translation flags: string interning and the shared cache are
+ * not used (see ROMClassCreationContext::isPrebuilding()). A prebuilt ROMClass is only used if
+ * the class file bytes being defined are identical and the translation flags are the same.
+ */
+class ROMClassPrebuilder
+{
+public:
+	static ROMClassPrebuilder *newInstance(J9JavaVM *javaVM, UDATA threadCount);
+	/**
+	 * Stop the prebuild threads, report the number of prebuilt ROMClasses which were used and
+	 * wasted (on the -verbose:dynload output if enabled and in a tracepoint) and free the prebuilder.
+	 */
+	void kill();
+
+	/**
+	 * Queue the classes of a bootstrap class path JAR to be built by the prebuild threads.
+	 *
+	 * @param cpEntry the class path entry of the JAR
+	 */
+	void prebuildJar(J9ClassPathEntry *cpEntry);
+
+	/**
+	 * Returns true if the ROMClass for loadData could have been prebuilt: the class is defined
+	 * by the bootstrap loader from unmodified class file bytes and is not an anonymous, hidden,
+	 * unsafe or redefined class.
+	 */
+	bool isPrebuildCandidate(J9LoadROMClassData *loadData);
+
+	/**
+	 * Copy the prebuilt ROMClass for the class being defined into memory from allocationStrategy.
+	 * The prebuilt ROMClass is discarded whether or not it matches the class.
+	 *
+	 * @param loadData the class being defined, must be a prebuild candidate
+	 * @param bctFlags translation flags used to define the class
+	 * @param allocationStrategy allocates the memory for the ROMClass
+	 * @return the ROMClass, or NULL if there is no prebuilt ROMClass for the class
+	 */
+	J9ROMClass *copyPrebuiltROMClass(J9LoadROMClassData *loadData, UDATA bctFlags, AllocationStrategy *allocationStrategy);
+
+protected:
+	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
+
+private:
+	struct PrebuildJar
+	{
+		PrebuildJar *next;
+		char *path;
+	};
+
+	struct PrebuiltROMClass
+	{
+		const U_8 *name; /* class name, in romClass (or the name searched for) */
+		UDATA nameLength;
+		J9ROMClass *romClass;
+		U_8 *classData; /* copy of the class file bytes the ROMClass was built from */
+		UDATA classDataLength;
+		UDATA bctFlags;
+		UDATA romMethodSortThreshold;
+	};
+
+	J9JavaVM *_javaVM;
+	J9PortLibrary *_portLibrary;
+	omrthread_monitor_t _monitor; /* protects all of the fields below */
+	J9HashTable *_prebuiltROMClasses; /* PrebuiltROMClass entries keyed by class name */
+	PrebuildJar *_jarQueueHead;
+	PrebuildJar *_jarQueueTail;
+	UDATA _threadCount; /* number of running prebuild threads */
+	bool _shutdown;
+	bool _bctFlagsKnown;
+	UDATA _bctFlags; /* translation flags of the last bootstrap class definition */
+	UDATA _prebuiltBytes; /* memory held by prebuilt ROMClasses and their class file bytes */
+	UDATA _prebuiltCount;
+	UDATA _usedCount;
+	UDATA _wastedCount;
+	UDATA _wastedBytes;
+	UDATA _failedCount;
+	UDATA _skippedCount;
+	UDATA _notPrebuiltCount;
+
+	ROMClassPrebuilder(J9JavaVM *javaVM);
+	bool initialize(UDATA threadCount);
+	void tearDown();
+	void reportStatistics();
+
+	static int J9THREAD_PROC prebuildThreadProc(void *entryArg);
+	void prebuildThreadLoop();
+	void prebuildClasses(ROMClassBuilder *romClassBuilder, const char *path, UDATA bctFlags);
+	void prebuildClass(ROMClassBuilder *romClassBuilder, const char *path, U_8 *classData, UDATA classDataLength, UDATA bctFlags);
+	void freePrebuiltROMClass(PrebuiltROMClass *entry);
+
+	static UDATA hashFn(void *key, void *userData);
+	static UDATA hashEqualFn(void *leftKey, void *rightKey, void *userData);
+};
+
+#endif /* ROMCLASSPREBUILDER_HPP_ */
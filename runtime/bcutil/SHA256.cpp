@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SHA256.hpp"
+
+#include <string.h>
+
+static const U_32 roundConstants[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline U_32
+rotateRight(U_32 value, U_32 count)
+{
+	return (value >> count) | (value << (32 - count));
+}
+
+SHA256::SHA256() :
+	_length(0),
+	_blockLength(0)
+{
+	_state[0] = 0x6a09e667;
+	_state[1] = 0xbb67ae85;
+	_state[2] = 0x3c6ef372;
+	_state[3] = 0xa54ff53a;
+	_state[4] = 0x510e527f;
+	_state[5] = 0x9b05688c;
+	_state[6] = 0x1f83d9ab;
+	_state[7] = 0x5be0cd19;
+}
+
+void
+SHA256::processBlock(const U_8 *block)
+{
+	U_32 w[64];
+	U_32 a = _state[0];
+	U_32 b = _state[1];
+	U_32 c = _state[2];
+	U_32 d = _state[3];
+	U_32 e = _state[4];
+	U_32 f = _state[5];
+	U_32 g = _state[6];
+	U_32 h = _state[7];
+
+	for (UDATA i = 0; i < 16; i++) {
+		w[i] = ((U_32)block[i * 4] << 24) | ((U_32)block[(i * 4) + 1] << 16) | ((U_32)block[(i * 4) + 2] << 8) | (U_32)block[(i * 4) + 3];
+	}
+	for (UDATA i = 16; i < 64; i++) {
+		U_32 s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+		U_32 s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+		w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+	}
+	for (UDATA i = 0; i < 64; i++) {
+		U_32 s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+		U_32 choice = (e & f) ^ (~e & g);
+		U_32 temp1 = h + s1 + choice + roundConstants[i] + w[i];
+		U_32 s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+		U_32 majority = (a & b) ^ (a & c) ^ (b & c);
+		U_32 temp2 = s0 + majority;
+		h = g;
+		g = f;
+		f = e;
+		e = d + temp1;
+		d = c;
+		c = b;
+		b = a;
+		a = temp1 + temp2;
+	}
+	_state[0] += a;
+	_state[1] += b;
+	_state[2] += c;
+	_state[3] += d;
+	_state[4] += e;
+	_state[5] += f;
+	_state[6] += g;
+	_state[7] += h;
+}
+
+void
+SHA256::update(const U_8 *bytes, UDATA length)
+{
+	_length += length;
+	if (0 != _blockLength) {
+		UDATA copyLength = BLOCK_LENGTH - _blockLength;
+		if (copyLength > length) {
+			copyLength = length;
+		}
+		memcpy(_block + _blockLength, bytes, copyLength);
+		_blockLength += copyLength;
+		bytes += copyLength;
+		length -= copyLength;
+		if (BLOCK_LENGTH == _blockLength) {
+			processBlock(_block);
+			_blockLength = 0;
+		}
+	}
+	while (length >= BLOCK_LENGTH) {
+		processBlock(bytes);
+		bytes += BLOCK_LENGTH;
+		length -= BLOCK_LENGTH;
+	}
+	if (0 != length) {
+		memcpy(_block, bytes, length);
+		_blockLength = length;
+	}
+}
+
+void
+SHA256::finish(U_8 *digest)
+{
+	U_64 bitLength = _length * 8;
+
+	/* pad with a 1 bit, zeros and the message length in bits, big endian */
+	_block[_blockLength++] = 0x80;
+	if (_blockLength > (BLOCK_LENGTH - 8)) {
+		memset(_block + _blockLength, 0, BLOCK_LENGTH - _blockLength);
+		processBlock(_block);
+		_blockLength = 0;
+	}
+	memset(_block + _blockLength, 0, (BLOCK_LENGTH - 8) - _blockLength);
+	for (UDATA i = 0; i < 8; i++) {
+		_block[(BLOCK_LENGTH - 1) - i] = (U_8)(bitLength >> (i * 8));
+	}
+	processBlock(_block);
+
+	for (UDATA i = 0; i < 8; i++) {
+		digest[i * 4] = (U_8)(_state[i] >> 24);
+		digest[(i * 4) + 1] = (U_8)(_state[i] >> 16);
+		digest[(i * 4) + 2] = (U_8)(_state[i] >> 8);
+		digest[(i * 4) + 3] = (U_8)_state[i];
+	}
+}
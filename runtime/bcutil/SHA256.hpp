@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * SHA256.hpp
+ */
+
+#ifndef SHA256_HPP_
+#define SHA256_HPP_
+
+/* @ddr_namespace: default */
+#include "j9comp.h"
+
+/**
+ * SHA-256 (FIPS 180-4) message digest, used where a class file must be identified by its
+ * bytes alone and a collision would make the VM use the wrong class.
+ */
+class SHA256
+{
+public:
+	enum {
+		DIGEST_LENGTH = 32,
+		BLOCK_LENGTH = 64
+	};
+
+	SHA256();
+
+	void update(const U_8 *bytes, UDATA length);
+	void finish(U_8 *digest);
+
+	static void digest(const U_8 *bytes, UDATA length, U_8 *digest)
+	{
+		SHA256 sha;
+		sha.update(bytes, length);
+		sha.finish(digest);
+	}
+
+private:
+	void processBlock(const U_8 *block);
+
+	U_32 _state[8];
+	U_64 _length;
+	U_8 _block[BLOCK_LENGTH];
+	UDATA _blockLength;
+};
+
+#endif /* SHA256_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -123,6 +123,8 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 	J9VMDllLoadInfo* loadInfo;
 	J9JImageIntf *jimageIntf = NULL;
 	J9TranslationBufferSet* translationBuffers;
+	IDATA argIndex = -1;
+	UDATA prebuildThreads = 0;
 
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	VMI_ACCESS_FROM_JAVAVM((JavaVM*)vm);
@@ -169,6 +171,20 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				returnVal = J9VMDLLMAIN_FAILED;
 			}
 			vm->mapMemoryBuffer = vm->mapMemoryResultsBuffer + MAP_MEMORY_RESULTS_BUFFER_SIZE;
+
+			/* ROMClasses of bootstrap class path JARs are only prebuilt when asked for */
+			if ((argIndex = FIND_AND_CONSUME_ARG(STARTSWITH_MATCH, VMOPT_XXROMCLASSPREBUILDTHREADS_EQUALS, NULL)) >= 0) {
+				char *optname = VMOPT_XXROMCLASSPREBUILDTHREADS_EQUALS;
+				if (OPTION_OK != GET_INTEGER_VALUE(argIndex, optname, prebuildThreads)) {
+					loadInfo->fatalErrorStr = "invalid value for -XX:ROMClassPrebuildThreads=";
+					returnVal = J9VMDLLMAIN_FAILED;
+					break;
+				}
+			}
+			if (0 != startupROMClassPrebuilder(vm, prebuildThreads)) {
+				loadInfo->fatalErrorStr = "startupROMClassPrebuilder failed";
+				returnVal = J9VMDLLMAIN_FAILED;
+			}
 			break;
 
 		case AGENTS_STARTED :
@@ -180,6 +196,7 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 		case LIBRARIES_ONUNLOAD :
 			loadInfo = FIND_DLL_TABLE_ENTRY( THIS_DLL_NAME );
 			if (IS_STAGE_COMPLETED(loadInfo->completedBits, BUFFERS_ALLOC_STAGE) && vm->dynamicLoadBuffers) {
+				shutdownROMClassPrebuilder(vm);
 				shutdownROMClassBuilder(vm);
 				j9bcutil_freeAllTranslationBuffers(vm->portLibrary, vm->dynamicLoadBuffers);
 				vm->dynamicLoadBuffers = 0;
@@ -127,6 +127,7 @@ static J9JITExceptionTable * jitGetExceptionTable(J9StackWalkState * walkState);
 
 static void jitAddSpilledRegistersForResolve(J9StackWalkState * walkState);
 static void jitWalkFrame(J9StackWalkState *walkState, UDATA walkLocals, void *stackMap);
+static void jitGetMapsFromPCCached(J9StackWalkState *walkState);
 static void jitWalkResolveMethodFrame(J9StackWalkState *walkState);
 static void jitWalkRegisterMap(J9StackWalkState *walkState, void *stackMap, J9JITStackAtlas *gcStackAtlas);
 static UDATA jitNextSigChar(U_8 ** utfData);
@@ -186,7 +187,7 @@ UDATA  jitWalkStackFrames(J9StackWalkState *walkState)
 		walkState->outgoingArgCount = walkState->argCount;
 
 		if ((!(walkState->flags & J9_STACKWALK_SKIP_INLINES)) && getJitInlinedCallInfo(walkState->jitInfo)) {
-			jitGetMapsFromPC(walkState->walkThread->javaVM, walkState->jitInfo, (UDATA) walkState->pc, &(walkState->stackMap), &(walkState->inlineMap));
+			jitGetMapsFromPCCached(walkState);
 			if (NULL != walkState->inlineMap) {
 				walkState->inlinedCallSite = getFirstInlinedCallSite(walkState->jitInfo, walkState->inlineMap);
 
@@ -217,7 +218,7 @@ resumeWalkInline:
 				}
 			}
 		} else if (walkState->flags & J9_STACKWALK_RECORD_BYTECODE_PC_OFFSET) {
-			jitGetMapsFromPC(walkState->walkThread->javaVM, walkState->jitInfo, (UDATA) walkState->pc, &(walkState->stackMap), &(walkState->inlineMap));
+			jitGetMapsFromPCCached(walkState);
 		}
 
 		SET_A0_CP_METHOD(walkState);
@@ -1478,6 +1479,10 @@ typedef struct TR_jit_artifact_search_cache
 {
 	UDATA volatile searchValue;
 	J9JITExceptionTable * volatile exceptionTable;
+	/* Decoded maps for the return address mapsPC within exceptionTable, see jitGetMapsFromPCCached() */
+	UDATA volatile mapsPC;
+	void * volatile stackMap;
+	void * volatile inlineMap;
 } TR_jit_artifact_search_cache;
 
 J9JITExceptionTable * jitGetExceptionTableFromPC(J9VMThread * vmThread, UDATA jitPC)
@@ -1524,6 +1529,7 @@ J9JITExceptionTable * jitGetExceptionTableFromPC(J9VMThread * vmThread, UDATA ji
 	 	} else {
 			exceptionTable = jit_artifact_search(vmThread->javaVM->jitConfig->translationArtifacts, maskedPC);
 			if (NULL != exceptionTable) {
+				cacheEntry->mapsPC = 0;
 				cacheEntry->searchValue = maskedPC;
 				cacheEntry->exceptionTable = exceptionTable;
 			}
@@ -1536,6 +1542,47 @@ noCache:
 }
 
 
+/* Look up the stack and inline maps for the current JIT frame.  Walks of the current thread (exception
+ * stack traces and StackWalker) tend to see the same return addresses over and over, so the decoded maps
+ * are kept in the thread's artifact search cache entry for the PC.  Only the owning thread stores maps in
+ * its cache; other threads walking it only ever reset mapsPC when they replace an entry, and the cache is
+ * cleaned while the owner is halted when metadata is reclaimed, so the maps read here belong to the PC.
+ */
+static void
+jitGetMapsFromPCCached(J9StackWalkState *walkState)
+{
+	J9VMThread *vmThread = walkState->walkThread;
+	J9JITExceptionTable *metaData = walkState->jitInfo;
+	UDATA jitPC = (UDATA)walkState->pc;
+#ifdef J9JIT_ARTIFACT_SEARCH_CACHE_ENABLE
+	TR_jit_artifact_search_cache *artifactSearchCache = vmThread->jitArtifactSearchCache;
+	if ((vmThread == walkState->currentThread) && (NULL != artifactSearchCache) && J9_ARE_NO_BITS_SET((UDATA)artifactSearchCache, J9_STACKWALK_NO_JIT_CACHE)) {
+		UDATA maskedPC = (UDATA)MASK_PC(jitPC);
+		TR_jit_artifact_search_cache *cacheEntry = &(artifactSearchCache[JIT_ARTIFACT_SEARCH_CACHE_HASH_RESULT(maskedPC)]);
+		if (cacheEntry->mapsPC == jitPC) {
+			issueReadBarrier();
+			if ((cacheEntry->searchValue == maskedPC) && (cacheEntry->exceptionTable == metaData)) {
+				walkState->stackMap = cacheEntry->stackMap;
+				walkState->inlineMap = cacheEntry->inlineMap;
+				vmThread->stackWalkMapsCacheHits += 1;
+				return;
+			}
+		}
+		jitGetMapsFromPC(vmThread->javaVM, metaData, jitPC, &(walkState->stackMap), &(walkState->inlineMap));
+		vmThread->stackWalkMapsDecoded += 1;
+		if ((cacheEntry->searchValue == maskedPC) && (cacheEntry->exceptionTable == metaData)) {
+			cacheEntry->stackMap = walkState->stackMap;
+			cacheEntry->inlineMap = walkState->inlineMap;
+			issueWriteBarrier();
+			cacheEntry->mapsPC = jitPC;
+		}
+		return;
+	}
+#endif /* J9JIT_ARTIFACT_SEARCH_CACHE_ENABLE */
+	jitGetMapsFromPC(vmThread->javaVM, metaData, jitPC, &(walkState->stackMap), &(walkState->inlineMap));
+}
+
+
 
 
 /* Only callable from inside a visible-only walk on the current thread (with VM access) */
@@ -91,6 +91,7 @@ int32_t J9::Options::_sampleThresholdVariationAllowance = 30;
 
 int32_t J9::Options::_maxCheckcastProfiledClassTests = 3;
 int32_t J9::Options::_maxOnsiteCacheSlotForInstanceOf = 0; // Setting this value to zero will disable onsite cache in instanceof.
+int32_t J9::Options::_largeArrayInlineAllocationThreshold = 0; // bytes; zero means any array that fits in the TLH is allocated inline
 int32_t J9::Options::_cpuEntitlementForConservativeScorching = 801; // 801 means more than 800%, i.e. 8 cpus
                                                                     // A very large number disables the feature
 int32_t J9::Options::_sampleHeartbeatInterval = 10;
@@ -879,6 +880,8 @@ TR::OptionTable OMR::Options::_feOptions[] = {
    {"jProfilingEnablementSampleThreshold=", "M<nnn>\tNumber of global samples to allow generation of JProfiling bodies",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_jProfilingEnablementSampleThreshold, 0, "F%d", NOT_IN_SUBSET },
    {"kcaoffsets",         "I\tGenerate a header file with offset data for use with KCA", TR::Options::kcaOffsets, 0, 0, "F" },
+   {"largeArrayInlineAllocationThreshold=", "C<nnn>\tarrays larger than this many bytes are allocated by the helper outside the TLH instead of inline",
+        TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_largeArrayInlineAllocationThreshold, 0, "F%d", NOT_IN_SUBSET},
    {"largeTranslationTime=", "D<nnn>\tprint IL trees for methods that take more than this value (usec)"
                              "to compile. Need to have a log file defined on command line",
         TR::Options::setStaticNumeric, (intptr_t)&TR::Options::_largeTranslationTime, 0, "F%d", NOT_IN_SUBSET},
@@ -120,6 +120,18 @@ class OMR_EXTENSIBLE Options : public OMR::OptionsConnector
     */
    static int32_t setMaxOnsiteCacheSlotForInstanceOf(int32_t m) {return _maxOnsiteCacheSlotForInstanceOf = m;}
 
+   static int32_t _largeArrayInlineAllocationThreshold;
+   /** \brief
+    *     Returns the _largeArrayInlineAllocationThreshold
+    *
+    *  \details
+    *     Array allocation sites whose size in bytes is above this threshold call the allocation helper instead of
+    *     bumping the TLH inline, so the GC allocates them outside the TLH and the TLH is kept for small objects.
+    *     Set this value to 0 to allocate every array that fits in the TLH inline.
+    *
+    */
+   static int32_t getLargeArrayInlineAllocationThreshold() {return _largeArrayInlineAllocationThreshold;}
+
    static int32_t _resetCountThreshold;
 
    static int32_t _scorchingSampleThreshold;
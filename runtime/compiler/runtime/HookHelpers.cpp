@@ -242,6 +242,9 @@ typedef struct TR_jit_artifact_search_cache
    {
       UDATA searchValue;
       J9JITExceptionTable * exceptionTable;
+      UDATA mapsPC;
+      void * stackMap;
+      void * inlineMap;
    } TR_jit_artifact_search_cache;
 
 void cleanUpJitArtifactSearchCache(J9VMThread *vmThread, J9JITExceptionTable *metaData)
@@ -260,6 +263,7 @@ void cleanUpJitArtifactSearchCache(J9VMThread *vmThread, J9JITExceptionTable *me
                && searchCache[counter].searchValue >= metaData->startColdPC && searchCache[counter].searchValue <= metaData->endPC))
                {
                searchCache[counter].searchValue=0;
+               searchCache[counter].mapsPC=0;
                }
             }
          }
@@ -6240,6 +6240,13 @@ static void genHeapAlloc(
          // of slush will exist between the top of the heap and the end of the address space.
          //
          uintptr_t maxObjectSize = cg->getMaxObjectSizeGuaranteedNotToOverflow();
+
+         // Arrays above the large array threshold are left to the helper so they do not use up the TLH.
+         //
+         if (TR::Options::getLargeArrayInlineAllocationThreshold() > 0 &&
+             (uintptr_t)TR::Options::getLargeArrayInlineAllocationThreshold() < maxObjectSize)
+            maxObjectSize = (uintptr_t)TR::Options::getLargeArrayInlineAllocationThreshold();
+
          uintptr_t maxObjectSizeInElements = maxObjectSize / elementSize;
 
          if (cg->comp()->target().is64Bit() && !(maxObjectSizeInElements > 0 && maxObjectSizeInElements <= (uintptr_t)INT_MAX))
@@ -6634,6 +6641,13 @@ static void genHeapAlloc2(
          // of slush will exist between the top of the heap and the end of the address space.
          //
          uintptr_t maxObjectSize = cg->getMaxObjectSizeGuaranteedNotToOverflow();
+
+         // Arrays above the large array threshold are left to the helper so they do not use up the TLH.
+         //
+         if (TR::Options::getLargeArrayInlineAllocationThreshold() > 0 &&
+             (uintptr_t)TR::Options::getLargeArrayInlineAllocationThreshold() < maxObjectSize)
+            maxObjectSize = (uintptr_t)TR::Options::getLargeArrayInlineAllocationThreshold();
+
          uintptr_t maxObjectSizeInElements = maxObjectSize / elementSize;
 
          if (cg->comp()->target().is64Bit() && !(maxObjectSizeInElements > 0 && maxObjectSizeInElements <= (uintptr_t)INT_MAX))
@@ -7778,6 +7792,19 @@ J9::X86::TreeEvaluator::VMnewEvaluator(
    objectSize = comp->canAllocateInline(node, clazz);
    if (objectSize < 0)
       return NULL;
+
+   // Large arrays of a known size are allocated by the helper, which places them outside the TLH,
+   // so that this site does not use up the TLH that the small objects allocated beside it depend on.
+   //
+   if (node->getOpCodeValue() != TR::New &&
+       TR::Options::getLargeArrayInlineAllocationThreshold() > 0 &&
+       objectSize > TR::Options::getLargeArrayInlineAllocationThreshold())
+      {
+      if (comp->getOption(TR_TraceCG))
+         traceMsg(comp, "cannot inline array allocation @ node %p because size %d is above the large array threshold %d\n",
+                  node, objectSize, TR::Options::getLargeArrayInlineAllocationThreshold());
+      return NULL;
+      }
    // Currently dynamic allocation is only supported on reference array.
    // We are performing dynamic array allocation if both object size and
    // class block cannot be statically determined.
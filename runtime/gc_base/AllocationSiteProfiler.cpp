@@ -0,0 +1,256 @@
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+#include "j9consts.h"
+#include "mmhook.h"
+#include "mmomrhook.h"
+
+#include "AllocationSiteProfiler.hpp"
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensions.hpp"
+
+/* number of entries probed before a sample is dropped */
+#define ALLOCATION_SITE_PROFILER_MAX_PROBES 16
+
+typedef struct AllocationSiteProfilerFrame {
+	J9Method *method;
+	UDATA bytecodeIndex;
+	bool isCompiled;
+} AllocationSiteProfilerFrame;
+
+static UDATA
+allocationSiteFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState)
+{
+	AllocationSiteProfilerFrame *frame = (AllocationSiteProfilerFrame *)walkState->userData1;
+
+	frame->method = walkState->method;
+	frame->bytecodeIndex = (UDATA)walkState->bytecodePCOffset;
+	frame->isCompiled = (NULL != walkState->jitInfo);
+
+	return J9_STACKWALK_STOP_ITERATING;
+}
+
+MM_AllocationSiteProfiler *
+MM_AllocationSiteProfiler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationSiteProfiler *profiler = (MM_AllocationSiteProfiler *)env->getForge()->allocate(sizeof(MM_AllocationSiteProfiler), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != profiler) {
+		new(profiler) MM_AllocationSiteProfiler(env);
+		if (!profiler->initialize(env)) {
+			profiler->kill(env);
+			profiler = NULL;
+		}
+	}
+	return profiler;
+}
+
+void
+MM_AllocationSiteProfiler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationSiteProfiler::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+
+	/* round the table size up to a power of two so the hash can be masked */
+	_siteCount = 1;
+	while (_siteCount < extensions->allocationSiteProfileTableSize) {
+		_siteCount <<= 1;
+	}
+
+	_sites = (Site *)env->getForge()->allocate(_siteCount * sizeof(Site), MM_AllocationCategory::DIAGNOSTIC, J9_GET_CALLSITE());
+	if (NULL == _sites) {
+		return false;
+	}
+	reset();
+
+	J9HookInterface **mmHooks = J9_HOOK_INTERFACE(extensions->hookInterface);
+	if ((*mmHooks)->J9HookRegisterWithCallSite(mmHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, allocationSiteProfilerSamplingHook, OMR_GET_CALLSITE(), this)) {
+		return false;
+	}
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	if ((*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, allocationSiteProfilerGlobalGCEndHook, OMR_GET_CALLSITE(), this)) {
+		return false;
+	}
+
+	/* JVMTI SampledObjectAlloc may later change the interval, the profiler then follows the JVMTI sampling rate */
+	if (UDATA_MAX == extensions->objectSamplingBytesGranularity) {
+		extensions->objectSamplingBytesGranularity = extensions->allocationSiteProfileInterval;
+	}
+
+	return true;
+}
+
+void
+MM_AllocationSiteProfiler::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+
+	J9HookInterface **mmHooks = J9_HOOK_INTERFACE(extensions->hookInterface);
+	if (NULL != *mmHooks) {
+		(*mmHooks)->J9HookUnregister(mmHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, allocationSiteProfilerSamplingHook, this);
+	}
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	if (NULL != *omrHooks) {
+		(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, allocationSiteProfilerGlobalGCEndHook, this);
+	}
+
+	if (NULL != _sites) {
+		env->getForge()->free(_sites);
+		_sites = NULL;
+	}
+}
+
+MM_AllocationSiteProfiler::Site *
+MM_AllocationSiteProfiler::findOrAddSite(J9Class *clazz, J9Method *method, UDATA bytecodeIndex, bool isCompiled)
+{
+	UDATA hash = ((UDATA)clazz >> 3) ^ ((UDATA)method >> 3) ^ (bytecodeIndex * 31) ^ (isCompiled ? 1 : 0);
+	UDATA mask = _siteCount - 1;
+
+	for (UDATA probe = 0; probe < ALLOCATION_SITE_PROFILER_MAX_PROBES; probe++) {
+		Site *site = &_sites[(hash + probe) & mask];
+		UDATA state = site->_state;
+
+		if (SITE_EMPTY == state) {
+			if (SITE_EMPTY == MM_AtomicOperations::lockCompareExchange(&site->_state, SITE_EMPTY, SITE_CLAIMED)) {
+				site->_hash = hash;
+				site->_clazz = clazz;
+				site->_method = method;
+				site->_bytecodeIndex = bytecodeIndex;
+				site->_isCompiled = isCompiled;
+				/* publish the key before the site can be matched by other threads */
+				MM_AtomicOperations::storeSync();
+				site->_state = SITE_READY;
+				return site;
+			}
+			state = site->_state;
+		}
+
+		/* another thread is filling this entry in, it only has a few stores left to do */
+		while (SITE_CLAIMED == state) {
+			MM_AtomicOperations::yieldCPU();
+			state = site->_state;
+		}
+		MM_AtomicOperations::loadSync();
+
+		if ((hash == site->_hash) && (clazz == site->_clazz) && (method == site->_method)
+			&& (bytecodeIndex == site->_bytecodeIndex) && (isCompiled == site->_isCompiled)
+		) {
+			return site;
+		}
+	}
+
+	return NULL;
+}
+
+void
+MM_AllocationSiteProfiler::recordSample(J9VMThread *vmThread, J9Class *clazz, UDATA objectSize)
+{
+	AllocationSiteProfilerFrame frame = { NULL, 0, false };
+	J9StackWalkState walkState;
+
+	/* only the top visible frame is needed, so the walk stops right away */
+	walkState.walkThread = vmThread;
+	walkState.skipCount = 0;
+	walkState.maxFrames = 1;
+	walkState.userData1 = (void *)&frame;
+	walkState.frameWalkFunction = allocationSiteFrameIterator;
+	walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_COUNT_SPECIFIED | J9_STACKWALK_RECORD_BYTECODE_PC_OFFSET;
+	_javaVM->walkStackFrames(vmThread, &walkState);
+
+	MM_AtomicOperations::add(&_sampleCount, 1);
+
+	Site *site = NULL;
+	if (NULL != frame.method) {
+		site = findOrAddSite(clazz, frame.method, frame.bytecodeIndex, frame.isCompiled);
+	}
+
+	if (NULL == site) {
+		MM_AtomicOperations::add(&_droppedSampleCount, 1);
+	} else {
+		MM_AtomicOperations::add(&site->_sampleCount, 1);
+		MM_AtomicOperations::add(&site->_sampledBytes, objectSize);
+	}
+}
+
+void
+MM_AllocationSiteProfiler::reset()
+{
+	memset(_sites, 0, _siteCount * sizeof(Site));
+	_sampleCount = 0;
+	_droppedSampleCount = 0;
+}
+
+UDATA
+MM_AllocationSiteProfiler::getTopSites(Site *topSites, UDATA maxSites)
+{
+	UDATA topCount = 0;
+
+	for (UDATA i = 0; i < _siteCount; i++) {
+		Site *site = &_sites[i];
+		if (SITE_READY == site->_state) {
+			/* insertion into the (short) sorted array of top sites */
+			UDATA position = topCount;
+			while ((0 < position) && (topSites[position - 1]._sampledBytes < site->_sampledBytes)) {
+				if (position < maxSites) {
+					topSites[position] = topSites[position - 1];
+				}
+				position -= 1;
+			}
+			if (position < maxSites) {
+				topSites[position] = *site;
+				if (topCount < maxSites) {
+					topCount += 1;
+				}
+			}
+		}
+	}
+
+	return topCount;
+}
+
+extern "C" {
+void
+allocationSiteProfilerSamplingHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_ObjectAllocationSamplingEvent *event = (MM_ObjectAllocationSamplingEvent *)eventData;
+	MM_AllocationSiteProfiler *profiler = (MM_AllocationSiteProfiler *)userData;
+
+	profiler->recordSample(event->currentThread, event->clazz, event->objectSize);
+}
+
+void
+allocationSiteProfilerGlobalGCEndHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData)
+{
+	MM_AllocationSiteProfiler *profiler = (MM_AllocationSiteProfiler *)userData;
+
+	profiler->reset();
+}
+} /* extern "C" */
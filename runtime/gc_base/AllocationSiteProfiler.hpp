@@ -0,0 +1,143 @@
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+#if !defined(ALLOCATIONSITEPROFILER_HPP_)
+#define ALLOCATIONSITEPROFILER_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+/* upper bound of -XXgc:allocationSiteProfileReportCount= */
+#define ALLOCATION_SITE_PROFILER_MAX_REPORT_COUNT 64
+
+extern "C" {
+/**
+ * Hook "J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING" callback function
+ * Attributes the sampled allocation to its allocation site
+ */
+void allocationSiteProfilerSamplingHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+/**
+ * Hook "J9HOOK_MM_OMR_GLOBAL_GC_END" callback function
+ * Starts a new profiling interval (classes may have been unloaded by the global GC)
+ */
+void allocationSiteProfilerGlobalGCEndHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+}
+
+/**
+ * Aggregates the allocation samples reported through J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING by
+ * allocation site (class, method, bytecode index and whether the method was compiled) into a
+ * fixed size, open addressed table which is updated lock-free by the allocating threads.
+ * The table is reported by verbose GC and cleared at the end of every global GC.
+ */
+class MM_AllocationSiteProfiler : public MM_BaseNonVirtual
+{
+public:
+	/**
+	 * One allocation site of the profile table.
+	 */
+	struct Site {
+		volatile UDATA _state; /**< SITE_EMPTY, SITE_CLAIMED or SITE_READY */
+		UDATA _hash; /**< hash of the site key, valid once the site is SITE_READY */
+		J9Class *_clazz; /**< class of the allocated objects */
+		J9Method *_method; /**< method containing the allocation */
+		UDATA _bytecodeIndex; /**< bytecode index of the allocation in _method */
+		bool _isCompiled; /**< true if the allocation happened in JIT compiled code */
+		volatile UDATA _sampleCount; /**< number of samples attributed to the site */
+		volatile UDATA _sampledBytes; /**< total size of the sampled objects */
+	};
+
+	enum {
+		SITE_EMPTY = 0,
+		SITE_CLAIMED,
+		SITE_READY
+	};
+
+private:
+	J9JavaVM *_javaVM;
+	Site *_sites; /**< the profile table */
+	UDATA _siteCount; /**< number of entries in _sites, always a power of two */
+	volatile UDATA _sampleCount; /**< number of samples seen in the current interval */
+	volatile UDATA _droppedSampleCount; /**< number of samples which could not be attributed to a site (table full or no Java frame) */
+
+protected:
+public:
+
+private:
+	/**
+	 * Find the site matching the key, claiming an empty entry for it if needed.
+	 * @return the site, or NULL if the table has no room left within the probe limit
+	 */
+	Site *findOrAddSite(J9Class *clazz, J9Method *method, UDATA bytecodeIndex, bool isCompiled);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_AllocationSiteProfiler *newInstance(MM_EnvironmentBase *env);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Attribute a sampled allocation to the allocation site of the top visible Java frame of the thread.
+	 * @param vmThread the allocating thread (must have a walkable stack)
+	 * @param clazz class of the allocated object
+	 * @param objectSize size in bytes of the allocated object
+	 */
+	void recordSample(J9VMThread *vmThread, J9Class *clazz, UDATA objectSize);
+
+	/**
+	 * Empty the table. Must be called while no thread can be recording samples (e.g. with exclusive VM access).
+	 */
+	void reset();
+
+	/**
+	 * Copy the sites with the most sampled bytes, in decreasing order.
+	 * @param topSites array receiving the sites
+	 * @param maxSites capacity of topSites
+	 * @return number of sites copied
+	 */
+	UDATA getTopSites(Site *topSites, UDATA maxSites);
+
+	MMINLINE UDATA getSampleCount() { return _sampleCount; }
+	MMINLINE UDATA getDroppedSampleCount() { return _droppedSampleCount; }
+
+	MM_AllocationSiteProfiler(MM_EnvironmentBase *env)
+		: MM_BaseNonVirtual()
+		, _javaVM((J9JavaVM *)env->getOmrVM()->_language_vm)
+		, _sites(NULL)
+		, _siteCount(0)
+		, _sampleCount(0)
+		, _droppedSampleCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ALLOCATIONSITEPROFILER_HPP_ */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,6 +30,7 @@
 #include "j9port.h"
 #include "util_api.h"
 
+#include "AllocationSiteProfiler.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
@@ -166,6 +167,11 @@ MM_GCExtensions::tearDown(MM_EnvironmentBase *env)
 	}
 	numaCommonThreadClassNamePatterns = NULL;
 	
+	if (NULL != allocationSiteProfiler) {
+		allocationSiteProfiler->kill(env);
+		allocationSiteProfiler = NULL;
+	}
+
 	J9HookInterface** tmpHookInterface = getHookInterface();
 	if((NULL != tmpHookInterface) && (NULL != *tmpHookInterface)){
 		(*tmpHookInterface)->J9HookShutdownInterface(tmpHookInterface);
@@ -51,6 +51,7 @@
 #include "ScavengerJavaStats.hpp"
 #endif /* J9VM_GC_MODRON_SCAVENGER */
 
+class MM_AllocationSiteProfiler;
 class MM_ClassLoaderManager;
 class MM_EnvironmentBase;
 class MM_HeapMap;
@@ -152,6 +153,13 @@ public:
 #endif /* J9VM_GC_FINALIZATION */
 
 	MM_ClassLoaderManager* classLoaderManager; /**< Pointer to the gc's classloader manager to process classloaders/classes */
+	MM_AllocationSiteProfiler* allocationSiteProfiler; /**< Aggregates allocation samples by allocation site, NULL unless -XXgc:allocationSiteProfile */
+	bool allocationSiteProfileEnabled; /**< if true, allocation samples are aggregated by allocation site and reported by verbose GC, for standard GC only */
+	UDATA allocationSiteProfileInterval; /**< allocation sampling interval, in bytes, used by the allocation site profiler unless JVMTI sets its own */
+	UDATA allocationSiteProfileTableSize; /**< number of allocation sites the profiler can hold (rounded up to a power of two) */
+	UDATA allocationSiteProfileReportCount; /**< number of allocation sites, with the most sampled bytes, reported by verbose GC */
+	bool markWorkStealing; /**< if true, global marking GC threads keep new work in a private work-stealing deque and only overflow to the shared work packets */
+	UDATA markWorkStealingDequeSize; /**< number of objects each GC thread's marking deque can hold (rounded up to a power of two) */
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 	UDATA deadClassLoaderCacheSize;
 #endif /*defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
@@ -189,12 +197,28 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	MM_IdleGCManager* idleGCManager; /**< Manager which registers for VM Runtime State notification & manages free heap on notification */
+	bool releaseFreeHeapAfterBurst; /**< if true, free heap pages are also released while the VM is active, once an allocation burst ends or memory is under pressure */
+	UDATA releaseFreeHeapAllocationRatePercent; /**< an allocation burst has ended when the allocation rate falls below this percentage of its peak */
+	UDATA releaseFreeHeapInterval; /**< minimum time, in milliseconds, between two releases of free heap while active */
+	UDATA releaseFreeHeapMemoryPressurePercent; /**< memory is under pressure when available physical (or container) memory is below this percentage of the total, 0 to ignore memory pressure */
 #endif
 
 	double maxRAMPercent; /**< Value of -XX:MaxRAMPercentage specified by the user */
 	double initialRAMPercent; /**< Value of -XX:InitialRAMPercentage specified by the user */
 	UDATA minimumFreeSizeForSurvivor; /**< minimum free size can be reused by collector as survivor, for balanced GC only */
 	UDATA freeSizeThresholdForSurvivor; /**< if average freeSize(freeSize/freeCount) of the region is smaller than the Threshold, the region would not be reused by collector as survivor, for balanced GC only */
+#if defined(J9VM_GC_MODRON_COMPACTION)
+	UDATA tenureFragmentationCompactThreshold; /**< if average freeSize(freeSize/freeCount) of tenure is smaller than the Threshold after a global GC, a compaction is requested (0 disables), for standard GC only */
+	UDATA tenureFragmentationCompactMaxDeferrals; /**< number of non-explicit global GCs a requested fragmentation compaction may wait for an explicit or idle GC before it is forced */
+	struct {
+		UDATA _freeBytes; /**< tenure free bytes measured at the end of the last global GC */
+		UDATA _freeEntryCount; /**< tenure free entry count measured at the end of the last global GC */
+		bool _compactRequested; /**< true if a compaction is pending because of tenure fragmentation */
+		UDATA _compactDeferrals; /**< number of global GCs the pending compaction has been deferred by */
+		UDATA _compactRequestCount; /**< number of compactions requested because of tenure fragmentation */
+		UDATA _compactPreventedCount; /**< number of global GCs forced to compact because of tenure fragmentation which did not compact */
+	} tenureFragmentationStats;
+#endif /* J9VM_GC_MODRON_COMPACTION */
 protected:
 private:
 protected:
@@ -310,6 +334,13 @@ public:
 		, finalizeWorkerPriority(J9THREAD_PRIORITY_NORMAL)
 #endif /* J9VM_GC_FINALIZATION */
 		, classLoaderManager(NULL)
+		, allocationSiteProfiler(NULL)
+		, allocationSiteProfileEnabled(false)
+		, allocationSiteProfileInterval(512 * 1024)
+		, allocationSiteProfileTableSize(4096)
+		, allocationSiteProfileReportCount(10)
+		, markWorkStealing(false)
+		, markWorkStealingDequeSize(1024)
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 		, deadClassLoaderCacheSize(1024 * 1024) /* default is one MiB */
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
@@ -322,13 +353,29 @@ public:
 		, _HeapManagementMXBeanBackCompatibilityEnabled(false)
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		, idleGCManager(NULL)
+		, releaseFreeHeapAfterBurst(false)
+		, releaseFreeHeapAllocationRatePercent(10)
+		, releaseFreeHeapInterval(60000) /* one minute */
+		, releaseFreeHeapMemoryPressurePercent(10)
 #endif
 		, maxRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, initialRAMPercent(0.0) /* this would get overwritten by user specified value */
 		, minimumFreeSizeForSurvivor(DEFAULT_SURVIVOR_MINIMUM_FREESIZE)
 		, freeSizeThresholdForSurvivor(DEFAULT_SURVIVOR_THRESHOLD)
+#if defined(J9VM_GC_MODRON_COMPACTION)
+		, tenureFragmentationCompactThreshold(0)
+		, tenureFragmentationCompactMaxDeferrals(4)
+#endif /* J9VM_GC_MODRON_COMPACTION */
 	{
 		_typeId = __FUNCTION__;
+#if defined(J9VM_GC_MODRON_COMPACTION)
+		tenureFragmentationStats._freeBytes = 0;
+		tenureFragmentationStats._freeEntryCount = 0;
+		tenureFragmentationStats._compactRequested = false;
+		tenureFragmentationStats._compactDeferrals = 0;
+		tenureFragmentationStats._compactRequestCount = 0;
+		tenureFragmentationStats._compactPreventedCount = 0;
+#endif /* J9VM_GC_MODRON_COMPACTION */
 	}
 };
 
@@ -1,6 +1,6 @@
 
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -27,12 +27,18 @@
 #include "j9protos.h"
 #include "j9consts.h"
 #include "vmhook_internal.h"
+#include "mmhook_internal.h"
+#include "mmomrhook.h"
 
 #include "IdleGCManager.hpp"
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensions.hpp"
 #include "OMRVMInterface.hpp"
 #include "Heap.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "VMThreadListIterator.hpp"
 
 MM_IdleGCManager *
 MM_IdleGCManager::newInstance(MM_EnvironmentBase* env)
@@ -58,22 +64,150 @@ MM_IdleGCManager::kill(MM_EnvironmentBase* env)
 void
 MM_IdleGCManager::tearDown(MM_EnvironmentBase* env)
 {
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
 	J9HookInterface** hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
 	if (NULL != hookInterface) {
 		(*hookInterface)->J9HookUnregister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this);
 	}
+
+	J9HookInterface** omrHookInterface = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	if (NULL != *omrHookInterface) {
+		(*omrHookInterface)->J9HookUnregister(omrHookInterface, J9HOOK_MM_OMR_LOCAL_GC_END, idleGCManagerLocalGCEndHook, this);
+	}
+
+	if (0 <= _releaseAsyncCallbackKey) {
+		_javaVM->internalVMFunctions->J9UnregisterAsyncEvent(_javaVM, _releaseAsyncCallbackKey);
+		_releaseAsyncCallbackKey = -1;
+	}
 }
 
 bool
 MM_IdleGCManager::initialize(MM_EnvironmentBase* env)
 {
-	J9HookInterface** hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
-	if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
-		return false;
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+
+	/* the manager is also created for releaseFreeHeapAfterBurst alone, only listen for state changes if idle tuning asked for it */
+	if (extensions->gcOnIdle) {
+		J9HookInterface** hookInterface = _javaVM->internalVMFunctions->getVMHookInterface(_javaVM);
+		if (NULL != hookInterface && (*hookInterface)->J9HookRegister(hookInterface, J9HOOK_VM_RUNTIME_STATE_CHANGED, idleGCManagerVMStateHook, this)) {
+			return false;
+		}
+	}
+
+	if (extensions->releaseFreeHeapAfterBurst) {
+		_releaseAsyncCallbackKey = _javaVM->internalVMFunctions->J9RegisterAsyncEvent(_javaVM, idleGCManagerReleaseAsyncHandler, this);
+		if (_releaseAsyncCallbackKey < 0) {
+			return false;
+		}
+		J9HookInterface** omrHookInterface = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+		if ((*omrHookInterface)->J9HookRegisterWithCallSite(omrHookInterface, J9HOOK_MM_OMR_LOCAL_GC_END, idleGCManagerLocalGCEndHook, OMR_GET_CALLSITE(), this)) {
+			return false;
+		}
 	}
 	return true;
 }
 
+bool
+MM_IdleGCManager::isMemoryUnderPressure()
+{
+	bool result = false;
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(_javaVM);
+
+	if (0 != extensions->releaseFreeHeapMemoryPressurePercent) {
+		PORT_ACCESS_FROM_JAVAVM(_javaVM);
+		J9MemoryInfo memoryInfo;
+		memset(&memoryInfo, 0, sizeof(memoryInfo));
+		/* the port library reports the container limits rather than the host ones when running in a cgroup */
+		if (0 == j9sysinfo_get_memory_info(&memoryInfo)) {
+			if ((J9PORT_MEMINFO_NOT_AVAILABLE != memoryInfo.totalPhysical) && (J9PORT_MEMINFO_NOT_AVAILABLE != memoryInfo.availPhysical)) {
+				result = ((memoryInfo.availPhysical * 100) < (memoryInfo.totalPhysical * extensions->releaseFreeHeapMemoryPressurePercent));
+			}
+		}
+	}
+	return result;
+}
+
+void
+MM_IdleGCManager::checkAllocationRate(MM_EnvironmentBase* env)
+{
+	MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+	PORT_ACCESS_FROM_JAVAVM(_javaVM);
+	U_64 now = j9time_hires_clock();
+
+	if (0 != _lastLocalGCEndTime) {
+		/* every local GC consumes (roughly) the whole allocate space of the nursery, so the interval between them gives the allocation rate */
+		U_64 intervalMillis = OMR_MAX(j9time_hires_delta(_lastLocalGCEndTime, now, J9PORT_TIME_DELTA_IN_MILLISECONDS), 1);
+		U_64 nurserySize = extensions->heap->getActiveMemorySize(MEMORY_TYPE_NEW);
+		_allocationRate = (UDATA)((nurserySize * 1000) / intervalMillis);
+		_peakAllocationRate = OMR_MAX(_peakAllocationRate, _allocationRate);
+	}
+	_lastLocalGCEndTime = now;
+
+	/* Between global collections, allocation and promotion only use up free tenure memory: pages recommitted
+	 * since the last release are in use, not free. Free pages which need releasing again only appear when a
+	 * global collection sweeps or compacts the tenure space, however much free memory there is afterwards.
+	 */
+	if ((0 == _releasePending) && (extensions->globalGCStats.gcCount != _lastReleaseGlobalGCCount)) {
+		bool intervalElapsed = (0 == _lastReleaseTime)
+				|| (j9time_hires_delta(_lastReleaseTime, now, J9PORT_TIME_DELTA_IN_MILLISECONDS) >= extensions->releaseFreeHeapInterval);
+		if (intervalElapsed) {
+			const char *reason = NULL;
+			if (isMemoryUnderPressure()) {
+				reason = "memory pressure";
+			} else if (((U_64)_allocationRate * 100) < ((U_64)_peakAllocationRate * extensions->releaseFreeHeapAllocationRatePercent)) {
+				reason = "allocation burst ended";
+			}
+
+			if (NULL != reason) {
+				_releaseReason = reason;
+				_lastReleaseTime = now;
+				_releasePending = 1;
+				/* Exclusive VM access is held so the thread list can not change. The first mutator to respond performs the release. */
+				J9InternalVMFunctions const * const vmFuncs = _javaVM->internalVMFunctions;
+				GC_VMThreadListIterator vmThreadListIterator(_javaVM);
+				J9VMThread *walkThread = NULL;
+				while (NULL != (walkThread = vmThreadListIterator.nextVMThread())) {
+					vmFuncs->J9SignalAsyncEvent(_javaVM, walkThread, _releaseAsyncCallbackKey);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_IdleGCManager::releaseFreeHeap(J9VMThread* currentThread)
+{
+	if (1 == MM_AtomicOperations::lockCompareExchange(&_releasePending, 1, 0)) {
+		MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(currentThread->omrVMThread);
+		MM_GCExtensions* extensions = MM_GCExtensions::getExtensions(env);
+		MM_MemorySubSpace* tenureMemorySubSpace = extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+		PORT_ACCESS_FROM_JAVAVM(_javaVM);
+
+		/* Decommit the pages of the free tenure entries directly, rather than collecting the heap to get there:
+		 * the free list only has to be stable, which exclusive VM access guarantees.
+		 */
+		env->acquireExclusiveVMAccess();
+		UDATA freeBytes = tenureMemorySubSpace->getApproximateActiveFreeMemorySize();
+		UDATA releasedBytes = tenureMemorySubSpace->releaseFreeMemoryPages(env);
+		_lastReleaseGlobalGCCount = extensions->globalGCStats.gcCount;
+		env->releaseExclusiveVMAccess();
+
+		TRIGGER_J9HOOK_MM_HEAP_FREE_MEMORY_RELEASED(
+			extensions->hookInterface,
+			currentThread,
+			j9time_hires_clock(),
+			J9HOOK_MM_HEAP_FREE_MEMORY_RELEASED,
+			_releaseReason,
+			_allocationRate,
+			_peakAllocationRate,
+			freeBytes,
+			releasedBytes);
+
+		/* start looking for the next burst from the current rate */
+		_peakAllocationRate = _allocationRate;
+	}
+}
+
 void
 MM_IdleGCManager::manageFreeHeap(J9VMThread* currentThread)
 {
@@ -96,5 +230,20 @@ void idleGCManagerVMStateHook(J9HookInterface** hook, uintptr_t eventNum, void*
 		idleMgr->manageFreeHeap(j9VMState->vmThread);
 	}
 }
+
+void idleGCManagerLocalGCEndHook(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	MM_LocalGCEndEvent* event = (MM_LocalGCEndEvent*)eventData;
+	MM_IdleGCManager* idleMgr = (MM_IdleGCManager*)userData;
+
+	idleMgr->checkAllocationRate(MM_EnvironmentBase::getEnvironment(event->currentThread));
+}
+
+void idleGCManagerReleaseAsyncHandler(J9VMThread *vmThread, IDATA handlerKey, void *userData)
+{
+	MM_IdleGCManager* idleMgr = (MM_IdleGCManager*)userData;
+
+	idleMgr->releaseFreeHeap(vmThread);
+}
 } /*end extern "C"  */
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
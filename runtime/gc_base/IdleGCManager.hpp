@@ -1,6 +1,6 @@
 
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -40,10 +40,21 @@ extern "C" {
  * Manages Heap Free Pages If Current Runtime State is IDLE
  */
 void idleGCManagerVMStateHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+/**
+ * Hook "J9HOOK_MM_OMR_LOCAL_GC_END" callback function
+ * Tracks the allocation rate and requests a free heap release once an allocation burst has ended
+ */
+void idleGCManagerLocalGCEndHook(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
+/**
+ * Async event handler which releases the free heap on the first mutator thread to respond to a release request
+ */
+void idleGCManagerReleaseAsyncHandler(J9VMThread *vmThread, IDATA handlerKey, void *userData);
 }
 
 /**
- * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook
+ * Manages free java heap memory whenever JVM becomes idle. Registers for VM Runtime State Notification Hook.
+ * When -XXgc:releaseFreeHeapAfterBurst is specified, also releases free heap memory while the JVM is active,
+ * once the allocation rate has dropped well below its recent peak or the OS (or container) runs low on memory.
  */
 class MM_IdleGCManager : public MM_BaseNonVirtual
 {
@@ -53,6 +64,15 @@ private:
 	 */
 	J9JavaVM* _javaVM;
 
+	IDATA _releaseAsyncCallbackKey; /**< async event used to run the release on a mutator thread, -1 if not registered */
+	volatile UDATA _releasePending; /**< 1 if a release has been requested and not yet picked up by a mutator thread */
+	const char *_releaseReason; /**< why the pending release was requested */
+	U_64 _lastLocalGCEndTime; /**< hires time of the end of the previous local GC, 0 if none yet */
+	U_64 _lastReleaseTime; /**< hires time of the last release request, 0 if none yet */
+	UDATA _allocationRate; /**< allocation rate in bytes per second measured over the last local GC interval */
+	UDATA _peakAllocationRate; /**< highest allocation rate measured since the last release */
+	UDATA _lastReleaseGlobalGCCount; /**< global GC count when the last release was made, UDATA_MAX if none yet */
+
 protected:
 public:
 
@@ -66,6 +86,11 @@ protected:
 	 * cleanup the object & unregisters registered hook
 	 */
 	void tearDown(MM_EnvironmentBase* env);
+	/**
+	 * Check if the OS (or container) has less available physical memory than -XXgc:releaseFreeHeapMemoryPressurePercent
+	 * @return true if memory is under pressure
+	 */
+	bool isMemoryUnderPressure();
 public:
 	/**
 	 * creates the object
@@ -79,6 +104,18 @@ public:
 	  * Whenever JVM becomes idle, uses the opportunity to free up pages of free java heap
 	  */
 	void manageFreeHeap(J9VMThread* currentThread);
+	/**
+	 * Called at the end of every local GC to measure the allocation rate and decide if free heap should be released.
+	 * Runs with exclusive VM access held.
+	 * @param env environment of the thread which completed the local GC
+	 */
+	void checkAllocationRate(MM_EnvironmentBase* env);
+	/**
+	 * Release free heap memory on behalf of a pending release request, if no other thread has picked it up already.
+	 * The pages of the free tenure memory are decommitted under exclusive VM access, without a collection.
+	 * The calling thread must hold VM access.
+	 */
+	void releaseFreeHeap(J9VMThread* currentThread);
 
 	/**
 	 * construct the object
@@ -86,6 +123,14 @@ public:
 	MM_IdleGCManager(MM_EnvironmentBase* env)
 		: MM_BaseNonVirtual()
 		, _javaVM((J9JavaVM*)env->getOmrVM()->_language_vm)
+		, _releaseAsyncCallbackKey(-1)
+		, _releasePending(0)
+		, _releaseReason(NULL)
+		, _lastLocalGCEndTime(0)
+		, _lastReleaseTime(0)
+		, _allocationRate(0)
+		, _peakAllocationRate(0)
+		, _lastReleaseGlobalGCCount(UDATA_MAX)
 	{
 		_typeId = __FUNCTION__;
 	}
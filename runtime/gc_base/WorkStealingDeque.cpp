@@ -0,0 +1,74 @@
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "WorkStealingDeque.hpp"
+#include "EnvironmentBase.hpp"
+
+/* smallest deque worth allocating */
+#define WORK_STEALING_DEQUE_MIN_CAPACITY 64
+
+MM_WorkStealingDeque *
+MM_WorkStealingDeque::newInstance(MM_EnvironmentBase *env, UDATA capacity)
+{
+	MM_WorkStealingDeque *deque = (MM_WorkStealingDeque *)env->getForge()->allocate(sizeof(MM_WorkStealingDeque), MM_AllocationCategory::FIXED, J9_GET_CALLSITE());
+	if (NULL != deque) {
+		new(deque) MM_WorkStealingDeque();
+		if (!deque->initialize(env, capacity)) {
+			deque->kill(env);
+			deque = NULL;
+		}
+	}
+	return deque;
+}
+
+void
+MM_WorkStealingDeque::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_WorkStealingDeque::initialize(MM_EnvironmentBase *env, UDATA capacity)
+{
+	_capacity = WORK_STEALING_DEQUE_MIN_CAPACITY;
+	while (_capacity < capacity) {
+		_capacity <<= 1;
+	}
+	_mask = _capacity - 1;
+
+	_buffer = (void **)env->getForge()->allocate(_capacity * sizeof(void *), MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+	return NULL != _buffer;
+}
+
+void
+MM_WorkStealingDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+}
@@ -0,0 +1,170 @@
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+#if !defined(WORKSTEALINGDEQUE_HPP_)
+#define WORKSTEALINGDEQUE_HPP_
+
+#include "j9.h"
+#include "j9cfg.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+/**
+ * Fixed capacity, lock-free work-stealing deque (Chase-Lev) of marking work items.
+ * The owning GC thread pushes and pops at the bottom without atomic operations on the fast path,
+ * other GC threads steal from the top with a single compare and swap.  A full deque refuses the push
+ * so the owner can overflow to the shared work packets.
+ * The indices only ever grow; the buffer slot of an index is found by masking, so the capacity is a power of two.
+ */
+class MM_WorkStealingDeque : public MM_BaseNonVirtual
+{
+private:
+	volatile UDATA _top; /**< index of the oldest item, advanced by thieves (and the owner taking the last item) */
+	volatile UDATA _bottom; /**< index of the next free slot, only written by the owner */
+	UDATA _capacity; /**< number of slots in _buffer (a power of two) */
+	UDATA _mask; /**< _capacity - 1 */
+	void **_buffer; /**< circular buffer of work items */
+
+protected:
+public:
+
+private:
+protected:
+	bool initialize(MM_EnvironmentBase *env, UDATA capacity);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	/**
+	 * Create a deque holding at least capacity items (rounded up to a power of two).
+	 */
+	static MM_WorkStealingDeque *newInstance(MM_EnvironmentBase *env, UDATA capacity);
+	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Push an item on the bottom of the deque.  Must only be called by the owning thread.
+	 * @param item the work item, must not be NULL
+	 * @return true if the item was pushed, false if the deque is full
+	 */
+	MMINLINE bool
+	push(void *item)
+	{
+		UDATA bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & _mask] = item;
+		/* the item must be visible to thieves before the new bottom */
+		MM_AtomicOperations::storeSync();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the most recently pushed item from the bottom of the deque.  Must only be called by the owning thread.
+	 * @return the item, or NULL if the deque is empty (or the last item was lost to a thief)
+	 */
+	MMINLINE void *
+	pop()
+	{
+		UDATA bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+		bottom -= 1;
+		_bottom = bottom;
+		/* the new bottom must be visible to thieves before reading top */
+		MM_AtomicOperations::sync();
+		UDATA top = _top;
+		void *item = NULL;
+		IDATA remaining = (IDATA)(bottom - top);
+		if (remaining > 0) {
+			item = _buffer[bottom & _mask];
+		} else {
+			if (0 == remaining) {
+				/* last item: race any thief for it */
+				item = _buffer[bottom & _mask];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					item = NULL;
+				}
+			}
+			/* the deque is now empty */
+			_bottom = bottom + 1;
+		}
+		return item;
+	}
+
+	/**
+	 * Steal the oldest item from the top of the deque.  May be called by any thread, including the owner.
+	 * @return the item, or NULL if the deque is empty or another thread won the race for the item
+	 */
+	MMINLINE void *
+	steal()
+	{
+		UDATA top = _top;
+		/* read top before bottom so that a concurrent pop of the last item is detected by the compare and swap */
+		MM_AtomicOperations::sync();
+		UDATA bottom = _bottom;
+		void *item = NULL;
+		if ((IDATA)(bottom - top) > 0) {
+			item = _buffer[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				item = NULL;
+			}
+		}
+		return item;
+	}
+
+	/**
+	 * @return true if the deque holds no items (a hint when called by a thread other than the owner)
+	 */
+	MMINLINE bool isEmpty() { return (IDATA)(_bottom - _top) <= 0; }
+
+	/**
+	 * @return number of items in the deque (exact only when called by the owner)
+	 */
+	MMINLINE UDATA getSize() { IDATA size = (IDATA)(_bottom - _top); return (size > 0) ? (UDATA)size : 0; }
+
+	/**
+	 * @return number of items the deque can hold
+	 */
+	MMINLINE UDATA getCapacity() { return _capacity; }
+
+	MM_WorkStealingDeque()
+		: MM_BaseNonVirtual()
+		, _top(0)
+		, _bottom(0)
+		, _capacity(0)
+		, _mask(0)
+		, _buffer(NULL)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* WORKSTEALINGDEQUE_HPP_ */
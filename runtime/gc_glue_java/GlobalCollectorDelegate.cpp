@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2017, 2020 IBM Corp. and others
+ * Copyright (c) 2017, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -47,6 +47,8 @@
 #include "HeapRegionIteratorStandard.hpp"
 #include "MarkingDelegate.hpp"
 #include "MarkingScheme.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
 #include "ObjectModel.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -135,6 +137,9 @@ MM_GlobalCollectorDelegate::mainThreadGarbageCollectStarted(MM_EnvironmentBase *
 
 #if defined(J9VM_GC_MODRON_COMPACTION)
 	_criticalSectionCount = MM_StandardAccessBarrier::getJNICriticalRegionCount(_extensions);
+	if (_extensions->tenureFragmentationStats._compactRequested) {
+		startFragmentationCompaction(env);
+	}
 #endif /* J9VM_GC_MODRON_COMPACTION */
 
 #if defined(J9VM_GC_MODRON_SCAVENGER)
@@ -237,6 +242,22 @@ MM_GlobalCollectorDelegate::mainThreadGarbageCollectFinished(MM_EnvironmentBase
 		}
 	}
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+
+#if defined(J9VM_GC_MODRON_COMPACTION)
+	/* a compaction forced because of tenure fragmentation is a one-shot request: restore the user's setting whether the
+	 * collection compacted or the compaction was prevented (e.g. by JNI critical regions). If tenure is still fragmented
+	 * the next fragmentation check requests a new one.
+	 */
+	if (_fragmentationCompactForced) {
+		_fragmentationCompactForced = false;
+		_extensions->compactOnGlobalGC = false;
+		_extensions->tenureFragmentationStats._compactRequested = false;
+		_extensions->tenureFragmentationStats._compactDeferrals = 0;
+		if (!compactedThisCycle) {
+			_extensions->tenureFragmentationStats._compactPreventedCount += 1;
+		}
+	}
+#endif /* J9VM_GC_MODRON_COMPACTION */
 }
 
 void
@@ -395,6 +416,12 @@ MM_GlobalCollectorDelegate::postCollect(MM_EnvironmentBase* env, MM_MemorySubSpa
 	double percentFree = ((double)freeSize) / ((double)heapSize);
 	_extensions->dynamicMaxSoftReferenceAge = (uintptr_t)(percentFree * (double)(_extensions->maxSoftReferenceAge));
 	Assert_MM_true(_extensions->dynamicMaxSoftReferenceAge <= _extensions->maxSoftReferenceAge);
+
+#if defined(J9VM_GC_MODRON_COMPACTION)
+	if (_extensions->isStandardGC() && (0 != _extensions->tenureFragmentationCompactThreshold)) {
+		checkTenureFragmentation(env);
+	}
+#endif /* J9VM_GC_MODRON_COMPACTION */
 }
 
 #if defined(J9VM_GC_MODRON_COMPACTION)
@@ -410,6 +437,50 @@ MM_GlobalCollectorDelegate::checkIfCompactionShouldBePrevented(MM_EnvironmentBas
 
 	return reason;
 }
+
+void
+MM_GlobalCollectorDelegate::checkTenureFragmentation(MM_EnvironmentBase *env)
+{
+	MM_MemorySubSpace *tenureMemorySubSpace = _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace();
+	MM_MemoryPool *tenureMemoryPool = tenureMemorySubSpace->getMemoryPool();
+	UDATA freeBytes = tenureMemoryPool->getActualFreeMemorySize();
+	UDATA freeEntryCount = tenureMemoryPool->getActualFreeEntryCount();
+
+	_extensions->tenureFragmentationStats._freeBytes = freeBytes;
+	_extensions->tenureFragmentationStats._freeEntryCount = freeEntryCount;
+
+	/* Do not override a user request to always or never compact. A single free entry can not be fragmented. */
+	bool fragmented = !_extensions->compactOnGlobalGC && !_extensions->noCompactOnGlobalGC
+			&& (1 < freeEntryCount) && ((freeBytes / freeEntryCount) < _extensions->tenureFragmentationCompactThreshold);
+
+	if (fragmented) {
+		if (!_extensions->tenureFragmentationStats._compactRequested) {
+			_extensions->tenureFragmentationStats._compactRequested = true;
+			_extensions->tenureFragmentationStats._compactRequestCount += 1;
+		}
+	} else {
+		/* sweeping coalesced enough free memory (or the user setting took over), the pending compaction is not needed any more */
+		_extensions->tenureFragmentationStats._compactRequested = false;
+		_extensions->tenureFragmentationStats._compactDeferrals = 0;
+	}
+}
+
+void
+MM_GlobalCollectorDelegate::startFragmentationCompaction(MM_EnvironmentBase *env)
+{
+	/* do not override a user request to always or never compact */
+	if (!_extensions->compactOnGlobalGC && !_extensions->noCompactOnGlobalGC) {
+		/* explicit collections include the idle GC, which is the cheapest time to take the pause */
+		if (env->_cycleState->_gcCode.isExplicitGC()
+			|| (_extensions->tenureFragmentationStats._compactDeferrals >= _extensions->tenureFragmentationCompactMaxDeferrals)
+		) {
+			_extensions->compactOnGlobalGC = true;
+			_fragmentationCompactForced = true;
+		} else {
+			_extensions->tenureFragmentationStats._compactDeferrals += 1;
+		}
+	}
+}
 #endif /* J9VM_GC_MODRON_COMPACTION */
 
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2017, 2020 IBM Corp. and others
+ * Copyright (c) 2017, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -46,6 +46,7 @@ protected:
 	MM_GlobalCollector *_globalCollector;
 #if defined(J9VM_GC_MODRON_COMPACTION)
 	uintptr_t _criticalSectionCount;
+	bool _fragmentationCompactForced; /**< true if compactOnGlobalGC was set for this cycle because of tenure fragmentation */
 #endif /* defined(J9VM_GC_MODRON_COMPACTION) */
 #if defined(J9VM_GC_FINALIZATION)
 	bool _finalizationRequired;
@@ -62,6 +63,24 @@ private:
 	void exitClassUnloadMutex(MM_EnvironmentBase *env);
 	void unloadDeadClassLoaders(MM_EnvironmentBase *env);
 #endif /* J9VM_GC_DYNAMIC_CLASS_UNLOADING */
+#if defined(J9VM_GC_MODRON_COMPACTION)
+	/**
+	 * Measure tenure fragmentation at the end of a global collection and request a compaction
+	 * if the average tenure free entry is smaller than MM_GCExtensions::tenureFragmentationCompactThreshold.
+	 * The request is withdrawn if a later collection finds tenure no longer fragmented.
+	 * @param env environment for calling thread
+	 */
+	void checkTenureFragmentation(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide at the start of a global collection whether a pending fragmentation compaction is
+	 * taken by this collection. Explicit and idle collections take it straight away; other
+	 * collections defer it up to MM_GCExtensions::tenureFragmentationCompactMaxDeferrals times
+	 * so the compaction pause is not added to an allocation failure when it can be avoided.
+	 * @param env environment for calling thread
+	 */
+	void startFragmentationCompaction(MM_EnvironmentBase *env);
+#endif /* J9VM_GC_MODRON_COMPACTION */
 
 protected:
 
@@ -112,6 +131,7 @@ public:
 		, _globalCollector(NULL)
 #if defined(J9VM_GC_MODRON_COMPACTION)
 		, _criticalSectionCount(0)
+		, _fragmentationCompactForced(false)
 #endif /* defined(J9VM_GC_MODRON_COMPACTION) */
 #if defined(J9VM_GC_FINALIZATION)
 		, _finalizationRequired(false)
@@ -70,6 +70,7 @@
 #if defined(J9VM_GC_REALTIME)
 #include "ConfigurationRealtime.hpp"
 #endif /* J9VM_GC_REALTIME */
+#include "AllocationSiteProfiler.hpp"
 #include "ClassLoaderManager.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
@@ -478,8 +479,15 @@ j9gc_initialize_heap(J9JavaVM *vm, IDATA *memoryParameterTable, UDATA heapBytesR
 		goto error_no_memory;
 	}
 
+	if (extensions->allocationSiteProfileEnabled && extensions->isStandardGC()) {
+		extensions->allocationSiteProfiler = MM_AllocationSiteProfiler::newInstance(&env);
+		if (NULL == extensions->allocationSiteProfiler) {
+			goto error_no_memory;
+		}
+	}
+
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
-	if (extensions->gcOnIdle) {
+	if (extensions->gcOnIdle || extensions->releaseFreeHeapAfterBurst) {
 		/* Enable idle tuning only for gencon policy */
 		if (gc_policy_gencon == extensions->configurationOptions._gcPolicy) {
 			extensions->idleGCManager = MM_IdleGCManager::newInstance(&env);
@@ -2873,6 +2881,12 @@ gcInitializeDefaults(J9JavaVM* vm)
 		memoryParameterTable[opt_Xmx] = memoryParameterTable[opt_maxRAMPercent];
 	}
 
+	if (extensions->markWorkStealing && (gc_policy_balanced != extensions->configurationOptions._gcPolicy)) {
+		/* only the balanced global marking scheme has the per thread marking deques */
+		j9nls_printf(PORTLIB, J9NLS_WARNING, J9NLS_GC_OPTIONS_MARK_WORK_STEALING_BALANCED_ONLY_WARN);
+		extensions->markWorkStealing = false;
+	}
+
 	if (gc_policy_metronome == extensions->configurationOptions._gcPolicy) {
 		/* Heap is segregated; take into account segregatedAllocationCache. */
 		vm->segregatedAllocationCacheSize = (J9VMGC_SIZECLASSES_NUM_SMALL + 1)*sizeof(J9VMGCSegregatedAllocationCacheEntry);
@@ -1142,6 +1142,74 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			continue ;
 		}
 
+		if (try_scan(&scan_start, "allocationSiteProfileInterval=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &extensions->allocationSiteProfileInterval, "allocationSiteProfileInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->allocationSiteProfileInterval) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "allocationSiteProfileTableSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->allocationSiteProfileTableSize, "allocationSiteProfileTableSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->allocationSiteProfileTableSize) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "allocationSiteProfileReportCount=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->allocationSiteProfileReportCount, "allocationSiteProfileReportCount=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->allocationSiteProfileReportCount > ALLOCATION_SITE_PROFILER_MAX_REPORT_COUNT) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "allocationSiteProfile")) {
+			extensions->allocationSiteProfileEnabled = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noAllocationSiteProfile")) {
+			extensions->allocationSiteProfileEnabled = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "markWorkStealingDequeSize=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->markWorkStealingDequeSize, "markWorkStealingDequeSize=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(0 == extensions->markWorkStealingDequeSize) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "markWorkStealing")) {
+			extensions->markWorkStealing = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noMarkWorkStealing")) {
+			extensions->markWorkStealing = false;
+			continue;
+		}
+
 		if (try_scan(&scan_start, "darkMatterCompactThreshold=")) {
 			UDATA percentage = 0;
 			if(!scan_udata_helper(vm, &scan_start, &percentage, "darkMatterCompactThreshold=")) {
@@ -1155,6 +1223,23 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->darkMatterCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+
+#if defined(J9VM_GC_MODRON_COMPACTION)
+		if (try_scan(&scan_start, "tenureFragmentationCompactThreshold=")) {
+			if(!scan_udata_memory_size_helper(vm, &scan_start, &extensions->tenureFragmentationCompactThreshold, "tenureFragmentationCompactThreshold=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+		if (try_scan(&scan_start, "tenureFragmentationCompactMaxDeferrals=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->tenureFragmentationCompactMaxDeferrals, "tenureFragmentationCompactMaxDeferrals=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+#endif /* defined(J9VM_GC_MODRON_COMPACTION) */
 		
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 		if (try_scan(&scan_start, "gcOnIdleCompactThreshold=")) {
@@ -1170,6 +1255,48 @@ gcParseXXgcArguments(J9JavaVM *vm, char *optArg)
 			extensions->gcOnIdleCompactThreshold = ((float)percentage) / 100.0f;
 			continue;
 		}
+
+		if (try_scan(&scan_start, "releaseFreeHeapAfterBurst")) {
+			extensions->releaseFreeHeapAfterBurst = true;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noReleaseFreeHeapAfterBurst")) {
+			extensions->releaseFreeHeapAfterBurst = false;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "releaseFreeHeapAllocationRatePercent=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->releaseFreeHeapAllocationRatePercent, "releaseFreeHeapAllocationRatePercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->releaseFreeHeapAllocationRatePercent > 100) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "releaseFreeHeapInterval=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->releaseFreeHeapInterval, "releaseFreeHeapInterval=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "releaseFreeHeapMemoryPressurePercent=")) {
+			if(!scan_udata_helper(vm, &scan_start, &extensions->releaseFreeHeapMemoryPressurePercent, "releaseFreeHeapMemoryPressurePercent=")) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			if(extensions->releaseFreeHeapMemoryPressurePercent > 100) {
+				returnValue = JNI_EINVAL;
+				break;
+			}
+			continue;
+		}
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 #if defined (J9VM_GC_VLHGC)
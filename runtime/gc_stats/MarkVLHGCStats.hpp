@@ -1,6 +1,6 @@
 
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -71,6 +71,9 @@ public:
 	UDATA _monitorReferenceCleared; /**< The number of monitor references that have been cleared during marking */
 	UDATA _monitorReferenceCandidates; /**< The number of monitor references that have been visited in monitor table during marking */
 
+	UDATA _workStolen; /**< The number of objects taken from another GC thread's marking deque (-XXgc:markWorkStealing) */
+	UDATA _workDequeOverflowed; /**< The number of objects moved from a marking deque to the shared work packets, because the deque was full or threads were waiting for work (-XXgc:markWorkStealing) */
+
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 	UDATA _doubleMappedArrayletsCleared; /**< The number of double mapped arraylets that have been cleared durign marking */
 	UDATA _doubleMappedArrayletsCandidates; /**< The number of double mapped arraylets that have been visited during marking */
@@ -105,6 +108,9 @@ public:
 		_monitorReferenceCleared = 0;
 		_monitorReferenceCandidates = 0;
 
+		_workStolen = 0;
+		_workDequeOverflowed = 0;
+
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		_doubleMappedArrayletsCleared = 0;
 		_doubleMappedArrayletsCandidates = 0;
@@ -135,6 +141,9 @@ public:
 		_monitorReferenceCleared += statsToMerge->_monitorReferenceCleared;
 		_monitorReferenceCandidates += statsToMerge->_monitorReferenceCandidates;
 
+		_workStolen += statsToMerge->_workStolen;
+		_workDequeOverflowed += statsToMerge->_workDequeOverflowed;
+
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		_doubleMappedArrayletsCleared += statsToMerge->_doubleMappedArrayletsCleared;
 		_doubleMappedArrayletsCandidates += statsToMerge->_doubleMappedArrayletsCandidates;
@@ -161,6 +170,8 @@ public:
 		,_stringConstantsCandidates(0)
 		,_monitorReferenceCleared(0)
 		,_monitorReferenceCandidates(0)
+		,_workStolen(0)
+		,_workDequeOverflowed(0)
 #if defined(J9VM_GC_ENABLE_DOUBLE_MAP)
 		,_doubleMappedArrayletsCleared(0)
 		,_doubleMappedArrayletsCandidates(0)
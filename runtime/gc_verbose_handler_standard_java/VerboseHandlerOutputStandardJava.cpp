@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -41,6 +41,10 @@
 static void verboseHandlerClassUnloadingEnd(J9HookInterface** hook, UDATA eventNum, void* eventData, void* userData);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 static void verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+static void verboseHandlerSlowExclusiveLastResponder(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+static void verboseHandlerHeapFreeMemoryReleased(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutputStandardJava::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -79,6 +83,16 @@ void
 MM_VerboseHandlerOutputStandardJava::outputMemoryInfoInnerStanzaInternal(MM_EnvironmentBase *env, UDATA indent, MM_CollectionStatistics *statsBase)
 {
 	MM_VerboseHandlerJava::outputFinalizableInfo(_manager, env, indent);
+
+#if defined(J9VM_GC_MODRON_COMPACTION)
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env->getOmrVM());
+	if (0 != extensions->tenureFragmentationCompactThreshold) {
+		_manager->getWriterChain()->formatAndOutput(env, indent, "<tenure-fragmentation freebytes=\"%zu\" freeentries=\"%zu\" threshold=\"%zu\" compactrequested=\"%s\" deferrals=\"%zu\" compactrequests=\"%zu\" compactsprevented=\"%zu\" />",
+				extensions->tenureFragmentationStats._freeBytes, extensions->tenureFragmentationStats._freeEntryCount, extensions->tenureFragmentationCompactThreshold,
+				extensions->tenureFragmentationStats._compactRequested ? "true" : "false", extensions->tenureFragmentationStats._compactDeferrals,
+				extensions->tenureFragmentationStats._compactRequestCount, extensions->tenureFragmentationStats._compactPreventedCount);
+	}
+#endif /* J9VM_GC_MODRON_COMPACTION */
 }
 
 void
@@ -90,6 +104,10 @@ MM_VerboseHandlerOutputStandardJava::enableVerbose()
 	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, OMR_GET_CALLSITE(), (void *)this);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, OMR_GET_CALLSITE(), (void *)this);
+	(*_vmHooks)->J9HookRegisterWithCallSite(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE_LAST_RESPONDER, verboseHandlerSlowExclusiveLastResponder, OMR_GET_CALLSITE(), (void *)this);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookRegisterWithCallSite(_mmHooks, J9HOOK_MM_HEAP_FREE_MEMORY_RELEASED, verboseHandlerHeapFreeMemoryReleased, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -102,6 +120,10 @@ MM_VerboseHandlerOutputStandardJava::disableVerbose()
 	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_CLASS_UNLOADING_END, verboseHandlerClassUnloadingEnd, NULL);
 #endif /* defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING) */
 	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE, verboseHandlerSlowExclusive, NULL);
+	(*_vmHooks)->J9HookUnregister(_vmHooks, J9HOOK_VM_SLOW_EXCLUSIVE_LAST_RESPONDER, verboseHandlerSlowExclusiveLastResponder, NULL);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	(*_mmHooks)->J9HookUnregister(_mmHooks, J9HOOK_MM_HEAP_FREE_MEMORY_RELEASED, verboseHandlerHeapFreeMemoryReleased, NULL);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 
 }
 
@@ -165,6 +187,8 @@ MM_VerboseHandlerOutputStandardJava::handleMarkEndInternal(MM_EnvironmentBase* e
 	outputStringConstantInfo(env, 1, markJavaStats->_stringConstantsCandidates, markJavaStats->_stringConstantsCleared);
 	outputMonitorReferenceInfo(env, 1, markJavaStats->_monitorReferenceCandidates, markJavaStats->_monitorReferenceCleared);
 
+	MM_VerboseHandlerJava::outputAllocationSiteInfo(_manager, env, 1);
+
 	if (workPacketStats->getSTWWorkStackOverflowOccured()) {
 		_manager->getWriterChain()->formatAndOutput(env, 1, "<warning details=\"work packet overflow\" count=\"%zu\" packetcount=\"%zu\" />",
 				workPacketStats->getSTWWorkStackOverflowCount(), workPacketStats->getSTWWorkpacketCountAtOverflow());
@@ -189,6 +213,56 @@ MM_VerboseHandlerOutputStandardJava::handleSlowExclusive(J9HookInterface **hook,
 
 }
 
+void
+MM_VerboseHandlerOutputStandardJava::handleSlowExclusiveLastResponder(J9HookInterface **hook, UDATA eventNum, void *eventData)
+{
+	J9VMSlowExclusiveLastResponderEvent *event = (J9VMSlowExclusiveLastResponderEvent *) eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseManager *manager = getManager();
+	MM_VerboseWriterChain *writer = manager->getWriterChain();
+
+	char threadName[64];
+	const char *lastResponderName = "unknown";
+	if (NULL != event->lastResponder) {
+		getThreadName(threadName,sizeof(threadName),event->lastResponder->omrVMThread);
+		lastResponderName = threadName;
+	}
+
+	enterAtomicReportingBlock();
+	if (NULL != event->method) {
+		J9UTF8 *className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(event->method)->romClass);
+		J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(event->method);
+		J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+		J9UTF8 *methodSig = J9ROMMETHOD_SIGNATURE(romMethod);
+		writer->formatAndOutput(env, 0, "<warning details=\"slow time to safepoint due to %s\" lastresponder=\"%s\" method=\"%.*s.%.*s%.*s\" bytecodeindex=\"%zu\" compiled=\"%s\" timeus=\"%zu\" haltedthreads=\"%zu\" />",
+				(event->reason == 1)?"JNICritical":"Exclusive Access", lastResponderName,
+				J9UTF8_LENGTH(className), J9UTF8_DATA(className), J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName), J9UTF8_LENGTH(methodSig), J9UTF8_DATA(methodSig),
+				event->bytecodeIndex, event->isCompiled ? "true" : "false", event->timeTaken, event->haltedThreads);
+	} else {
+		writer->formatAndOutput(env, 0, "<warning details=\"slow time to safepoint due to %s\" lastresponder=\"%s\" timeus=\"%zu\" haltedthreads=\"%zu\" />",
+				(event->reason == 1)?"JNICritical":"Exclusive Access", lastResponderName, event->timeTaken, event->haltedThreads);
+	}
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+void
+MM_VerboseHandlerOutputStandardJava::handleHeapFreeMemoryReleased(J9HookInterface **hook, UDATA eventNum, void *eventData)
+{
+	MM_HeapFreeMemoryReleasedEvent *event = (MM_HeapFreeMemoryReleasedEvent *) eventData;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread->omrVMThread);
+	MM_VerboseManager *manager = getManager();
+	MM_VerboseWriterChain *writer = manager->getWriterChain();
+
+	enterAtomicReportingBlock();
+	writer->formatAndOutput(env, 0, "<heap-release reason=\"%s\" allocationrate=\"%zu\" peakallocationrate=\"%zu\" freebytes=\"%zu\" releasedbytes=\"%zu\" />",
+			event->reason, event->allocationRate, event->peakAllocationRate, event->freeBytes, event->releasedBytes);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
+
 #if defined(J9VM_GC_DYNAMIC_CLASS_UNLOADING)
 void
 MM_VerboseHandlerOutputStandardJava::handleClassUnloadEnd(J9HookInterface** hook, UDATA eventNum, void* eventData)
@@ -329,3 +403,17 @@ verboseHandlerSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventD
 {
 	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusive(hook, eventNum, eventData);
 }
+
+void
+verboseHandlerSlowExclusiveLastResponder(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleSlowExclusiveLastResponder(hook, eventNum, eventData);
+}
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+void
+verboseHandlerHeapFreeMemoryReleased(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	((MM_VerboseHandlerOutputStandardJava *)userData)->handleHeapFreeMemoryReleased(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
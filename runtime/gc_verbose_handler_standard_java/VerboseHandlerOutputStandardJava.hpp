@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -116,6 +116,24 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleSlowExclusive(J9HookInterface **hook, UDATA eventNum, void *eventData);
+
+	/**
+	 * Write verbose stanza identifying the last thread to respond to a slow exclusive request.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleSlowExclusiveLastResponder(J9HookInterface **hook, UDATA eventNum, void *eventData);
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	/**
+	 * Write verbose stanza for a release of free heap memory while the VM is active.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleHeapFreeMemoryReleased(J9HookInterface **hook, UDATA eventNum, void *eventData);
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 };
 
 #endif /* VERBOSEHANDLEROUTPUTSTANDARDJAVA_HPP_ */
@@ -551,6 +551,11 @@ MM_VerboseHandlerOutputVLHGC::outputMarkSummary(MM_EnvironmentBase *env, const c
 				markStats->_objectsCardClean, markStats->_bytesCardClean);
 	}
 
+	if ((0 != markStats->_workStolen) || (0 != markStats->_workDequeOverflowed)) {
+		writer->formatAndOutput(env, 1, "<work-stealing stolen=\"%zu\" overflowed=\"%zu\" />",
+				markStats->_workStolen, markStats->_workDequeOverflowed);
+	}
+
 	if (NULL != irrsStats) {
 		/* report only for PGC */
 		outputRememberedSetClearedInfo(env, irrsStats);
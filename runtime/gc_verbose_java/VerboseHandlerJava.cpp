@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -25,8 +25,10 @@
 #include "j9.h"
 #include "j9cfg.h"
 #include "mmhook.h"
+#include "rommeth.h"
 
 #include "VerboseHandlerJava.hpp"
+#include "AllocationSiteProfiler.hpp"
 #include "EnvironmentBase.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseHandlerOutput.hpp"
@@ -51,6 +53,46 @@ MM_VerboseHandlerJava::outputFinalizableInfo(MM_VerboseManager *manager, MM_Envi
 	}
 }
 
+void
+MM_VerboseHandlerJava::outputAllocationSiteInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent)
+{
+	MM_GCExtensions *extensions = MM_GCExtensions::getExtensions(env);
+	MM_AllocationSiteProfiler *profiler = extensions->allocationSiteProfiler;
+
+	if ((NULL != profiler) && (0 != profiler->getSampleCount())) {
+		PORT_ACCESS_FROM_ENVIRONMENT(env);
+		MM_VerboseWriterChain *writer = manager->getWriterChain();
+		MM_AllocationSiteProfiler::Site topSites[ALLOCATION_SITE_PROFILER_MAX_REPORT_COUNT];
+		UDATA topCount = profiler->getTopSites(topSites, extensions->allocationSiteProfileReportCount);
+
+		writer->formatAndOutput(env, indent, "<allocation-sites samples=\"%zu\" dropped=\"%zu\" interval=\"%zu\">",
+				profiler->getSampleCount(), profiler->getDroppedSampleCount(), extensions->objectSamplingBytesGranularity);
+		for (UDATA i = 0; i < topCount; i++) {
+			MM_AllocationSiteProfiler::Site *site = &topSites[i];
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(site->_clazz->romClass);
+			J9UTF8 *methodClassName = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(site->_method)->romClass);
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(site->_method);
+			J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *methodSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+			char name[512];
+			char escapedClassName[512];
+			char escapedMethodName[512];
+
+			/* method names such as <init> and <clinit> must be escaped */
+			UDATA nameLength = j9str_printf(PORTLIB, name, sizeof(name), "%.*s.%.*s%.*s",
+					(U_32)J9UTF8_LENGTH(methodClassName), J9UTF8_DATA(methodClassName),
+					(U_32)J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName),
+					(U_32)J9UTF8_LENGTH(methodSignature), J9UTF8_DATA(methodSignature));
+			escapeXMLString(OMRPORT_FROM_J9PORT(PORTLIB), escapedMethodName, sizeof(escapedMethodName), name, nameLength);
+			escapeXMLString(OMRPORT_FROM_J9PORT(PORTLIB), escapedClassName, sizeof(escapedClassName), (const char *)J9UTF8_DATA(className), J9UTF8_LENGTH(className));
+
+			writer->formatAndOutput(env, indent + 1, "<allocation-site class=\"%s\" method=\"%s\" bci=\"%zu\" compiled=\"%s\" samples=\"%zu\" sampledbytes=\"%zu\" />",
+					escapedClassName, escapedMethodName, site->_bytecodeIndex, site->_isCompiled ? "true" : "false", site->_sampleCount, site->_sampledBytes);
+		}
+		writer->formatAndOutput(env, indent, "</allocation-sites>");
+	}
+}
+
 bool
 MM_VerboseHandlerJava::getThreadName(char *buf, UDATA bufLen, OMR_VMThread *omrThread)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -43,6 +43,14 @@ public:
 	 */
 	static void outputFinalizableInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
 
+	/**
+	 * Output the allocation sites with the most sampled bytes since the last global GC (-XXgc:allocationSiteProfile).
+	 * @param manager
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 */
+	static void outputAllocationSiteInfo(MM_VerboseManager *manager, MM_EnvironmentBase *env, UDATA indent);
+
 	/**
 	 * Output the name of the thread into the buffer.
 	 * @return Whether the thread name was truncated.
@@ -85,6 +85,7 @@
 #include "WorkPacketsIterator.hpp"
 #include "WorkPacketsVLHGC.hpp"
 #include "WorkStack.hpp"
+#include "WorkStealingDeque.hpp"
 
 void
 MM_ParallelGlobalMarkTask::mainSetup(MM_EnvironmentBase *env)
@@ -295,6 +296,22 @@ MM_GlobalMarkingScheme::initialize(MM_EnvironmentVLHGC *env)
 	 */
 	_arraySplitSize = 4096;
 	_interRegionRememberedSet = MM_GCExtensions::getExtensions(env)->interRegionRememberedSet;
+
+	if (_extensions->markWorkStealing) {
+		UDATA dequeCount = _extensions->gcThreadCount;
+		_workDeques = (MM_WorkStealingDeque **)env->getForge()->allocate(sizeof(MM_WorkStealingDeque *) * dequeCount, MM_AllocationCategory::WORK_PACKETS, J9_GET_CALLSITE());
+		if (NULL == _workDeques) {
+			return false;
+		}
+		memset(_workDeques, 0, sizeof(MM_WorkStealingDeque *) * dequeCount);
+		_workDequeCount = dequeCount;
+		for (UDATA i = 0; i < dequeCount; i++) {
+			_workDeques[i] = MM_WorkStealingDeque::newInstance(env, _extensions->markWorkStealingDequeSize);
+			if (NULL == _workDeques[i]) {
+				return false;
+			}
+		}
+	}
 	return true;
 }
 
@@ -304,6 +321,16 @@ MM_GlobalMarkingScheme::initialize(MM_EnvironmentVLHGC *env)
 void
 MM_GlobalMarkingScheme::tearDown(MM_EnvironmentVLHGC *env)
 {
+	if (NULL != _workDeques) {
+		for (UDATA i = 0; i < _workDequeCount; i++) {
+			if (NULL != _workDeques[i]) {
+				_workDeques[i]->kill(env);
+			}
+		}
+		env->getForge()->free(_workDeques);
+		_workDeques = NULL;
+		_workDequeCount = 0;
+	}
 }
 
 /**
@@ -402,6 +429,141 @@ MM_GlobalMarkingScheme::isMarked(J9Object *objectPtr)
 	return true;
 }
 
+MMINLINE MM_WorkStealingDeque *
+MM_GlobalMarkingScheme::getWorkDeque(MM_EnvironmentVLHGC *env)
+{
+	MM_WorkStealingDeque *deque = NULL;
+	if (NULL != _workDeques) {
+		UDATA workerID = env->getWorkerID();
+		if (workerID < _workDequeCount) {
+			deque = _workDeques[workerID];
+		}
+	}
+	return deque;
+}
+
+MMINLINE void
+MM_GlobalMarkingScheme::shareWorkDeque(MM_EnvironmentVLHGC *env, MM_WorkStealingDeque *deque, UDATA shareCount)
+{
+	/* hand the oldest (and likely largest) subgraphs to the work packets where any thread can pick them up */
+	for (UDATA i = 0; i < shareCount; i++) {
+		void *sharedObject = deque->steal();
+		if (NULL == sharedObject) {
+			break;
+		}
+		env->_workStack.push(env, sharedObject);
+		env->_markVLHGCStats._workDequeOverflowed += 1;
+	}
+	env->_workStack.flushOutputPacket(env);
+}
+
+MMINLINE void
+MM_GlobalMarkingScheme::pushWork(MM_EnvironmentVLHGC *env, J9Object *objectPtr)
+{
+	MM_WorkStealingDeque *deque = getWorkDeque(env);
+	if (NULL == deque) {
+		env->_workStack.push(env, objectPtr);
+	} else if (!deque->push(objectPtr)) {
+		/* the deque is full */
+		shareWorkDeque(env, deque, deque->getCapacity() / 2);
+		if (!deque->push(objectPtr)) {
+			env->_workStack.push(env, objectPtr);
+		}
+	} else if ((0 != _workPacketWaiters) && (1 < deque->getSize())) {
+		/* Threads blocked on the work packets can not see the deques, so wake them up with half of this deque */
+		shareWorkDeque(env, deque, deque->getSize() / 2);
+	}
+}
+
+J9Object *
+MM_GlobalMarkingScheme::stealWork(MM_EnvironmentVLHGC *env)
+{
+	J9Object *objectPtr = NULL;
+	UDATA workerID = env->getWorkerID();
+	for (UDATA i = 1; (NULL == objectPtr) && (i < _workDequeCount); i++) {
+		MM_WorkStealingDeque *victim = _workDeques[(workerID + i) % _workDequeCount];
+		if (!victim->isEmpty()) {
+			objectPtr = (J9Object *)victim->steal();
+		}
+	}
+	if (NULL != objectPtr) {
+		env->_markVLHGCStats._workStolen += 1;
+	}
+	return objectPtr;
+}
+
+MMINLINE J9Object *
+MM_GlobalMarkingScheme::popWorkNoWait(MM_EnvironmentVLHGC *env)
+{
+	J9Object *objectPtr = NULL;
+	MM_WorkStealingDeque *deque = getWorkDeque(env);
+	if (NULL != deque) {
+		objectPtr = (J9Object *)deque->pop();
+	}
+	if (NULL == objectPtr) {
+		objectPtr = (J9Object *)env->_workStack.popNoWait(env);
+	}
+	return objectPtr;
+}
+
+MMINLINE bool
+MM_GlobalMarkingScheme::isAnyWorkDequeNonEmpty()
+{
+	for (UDATA i = 0; i < _workDequeCount; i++) {
+		if (!_workDeques[i]->isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MMINLINE J9Object *
+MM_GlobalMarkingScheme::popWork(MM_EnvironmentVLHGC *env)
+{
+	J9Object *objectPtr = NULL;
+	if (NULL != getWorkDeque(env)) {
+		/* A steal can fail because another thief won the race, so keep trying for as long as any deque has work */
+		while (NULL == objectPtr) {
+			objectPtr = popWorkNoWait(env);
+			if (NULL == objectPtr) {
+				objectPtr = stealWork(env);
+				if (NULL == objectPtr) {
+					if (!isAnyWorkDequeNonEmpty()) {
+						break;
+					}
+					MM_AtomicOperations::yieldCPU();
+				}
+			}
+		}
+	}
+	if (NULL == objectPtr) {
+		/* Only wait on the work packets with an empty deque: a thread holding deque work is never idle, so the work packets can not
+		 * declare marking complete while any deque still has objects. Work pushed on a deque while threads wait here is shared
+		 * through the work packets (see pushWork()), so the waiting threads are woken up for it.
+		 */
+		if (NULL != getWorkDeque(env)) {
+			MM_AtomicOperations::add(&_workPacketWaiters, 1);
+			objectPtr = (J9Object *)env->_workStack.pop(env);
+			MM_AtomicOperations::subtract(&_workPacketWaiters, 1);
+		} else {
+			objectPtr = (J9Object *)env->_workStack.pop(env);
+		}
+	}
+	return objectPtr;
+}
+
+void
+MM_GlobalMarkingScheme::flushWorkDeque(MM_EnvironmentVLHGC *env)
+{
+	MM_WorkStealingDeque *deque = getWorkDeque(env);
+	if (NULL != deque) {
+		void *objectPtr = NULL;
+		while (NULL != (objectPtr = deque->pop())) {
+			env->_workStack.push(env, objectPtr);
+		}
+	}
+}
+
 MMINLINE bool
 MM_GlobalMarkingScheme::markObjectNoCheck(MM_EnvironmentVLHGC *env, J9Object *objectPtr, bool leafType)
 {
@@ -412,7 +574,7 @@ MM_GlobalMarkingScheme::markObjectNoCheck(MM_EnvironmentVLHGC *env, J9Object *ob
 
 	/* mark successful - Attempt to add to the work stack */
 	if(!leafType) {
-		env->_workStack.push(env, objectPtr);
+		pushWork(env, objectPtr);
 	}
 
 	env->_markVLHGCStats._objectsMarked += 1;
@@ -905,11 +1067,11 @@ MM_GlobalMarkingScheme::completeScan(MM_EnvironmentVLHGC *env)
 	PORT_ACCESS_FROM_ENVIRONMENT(env);
 	do {
 		J9Object *objectPtr = NULL;
-		while (NULL != (objectPtr = (J9Object *)env->_workStack.pop(env))) {
+		while (NULL != (objectPtr = popWork(env))) {
 			U_64 scanStartTime = j9time_hires_clock();
 			do {
 				scanObject(env, objectPtr, SCAN_REASON_PACKET);
-				objectPtr = (J9Object *)env->_workStack.popNoWait(env);
+				objectPtr = popWorkNoWait(env);
 			} while (NULL != objectPtr);
 			U_64 scanEndTime = j9time_hires_clock();
 			env->_markVLHGCStats.addToScanTime(scanStartTime, scanEndTime);
@@ -1671,6 +1833,8 @@ MM_GlobalMarkingScheme::processReferenceList(MM_EnvironmentVLHGC *env, J9Object*
 void 
 MM_GlobalMarkingScheme::flushBuffers(MM_EnvironmentVLHGC *env)
 {
+	/* the next task may run on a different set of threads, so leave no work behind in the deque */
+	flushWorkDeque(env);
 	env->_workStack.flush(env);
 	env->getGCEnvironment()->_referenceObjectBuffer->flush(env);
 }
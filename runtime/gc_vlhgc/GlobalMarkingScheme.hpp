@@ -58,6 +58,7 @@ class MM_ReferenceStats;
 class MM_RootScanner;
 class MM_SublistPool;
 class MM_WorkPacketsVLHGC;
+class MM_WorkStealingDeque;
 
 
 enum MarkAction {
@@ -202,6 +203,9 @@ private:
 	MM_InterRegionRememberedSet *_interRegionRememberedSet;	/**< A cached pointer to the  inter-region reference tracking  */
 	const bool _collectStringConstantsEnabled;
 	const UDATA _regionSize;	/**< Cached copy of the region size used for short-circuiting region matching checks with the XOR-and-compare */
+	MM_WorkStealingDeque **_workDeques;	/**< Per GC thread marking deques, indexed by worker ID (NULL unless -XXgc:markWorkStealing) */
+	UDATA _workDequeCount;	/**< Number of entries in _workDeques */
+	volatile UDATA _workPacketWaiters;	/**< Number of GC threads with an empty deque waiting for work packets */
 
 	/**
 	 * Codes used to indicate why an object is being scanned
@@ -228,6 +232,64 @@ private:
 
 	bool markObjectNoCheck(MM_EnvironmentVLHGC *env, J9Object *objectPtr, bool leafType = false);
 
+	/**
+	 * @param env[in] The GC thread
+	 * @return the marking deque owned by env, or NULL if work stealing is disabled
+	 */
+	MM_WorkStealingDeque *getWorkDeque(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Queue a newly marked object for scanning.  With work stealing the object goes on the thread's own deque, and
+	 * the oldest half of a full deque overflows to the work packets.  Otherwise the object goes on the work stack.
+	 * @note This must be private as it is inlined in the implementation and will not generate a symbol
+	 * @param env[in] The GC thread
+	 * @param objectPtr[in] The object to scan
+	 */
+	void pushWork(MM_EnvironmentVLHGC *env, J9Object *objectPtr);
+
+	/**
+	 * Get the next object to scan from the thread's own deque, the work packets or (if both are empty) another thread's deque,
+	 * waiting on the work packets if no work can be found.
+	 * @note This must be private as it is inlined in the implementation and will not generate a symbol
+	 * @param env[in] The GC thread
+	 * @return the object to scan, or NULL if all threads are out of work (or the increment must yield)
+	 */
+	J9Object *popWork(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Get the next object to scan from the thread's own deque or the work packets, without waiting.
+	 * @note This must be private as it is inlined in the implementation and will not generate a symbol
+	 * @param env[in] The GC thread
+	 * @return the object to scan, or NULL if the thread has no local work
+	 */
+	J9Object *popWorkNoWait(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * Steal an object from the deque of another GC thread.
+	 * @param env[in] The GC thread
+	 * @return the stolen object, or NULL if none could be stolen
+	 */
+	J9Object *stealWork(MM_EnvironmentVLHGC *env);
+
+	/**
+	 * @return true if the deque of any GC thread holds objects (a hint, as the deques may be changing)
+	 */
+	bool isAnyWorkDequeNonEmpty();
+
+	/**
+	 * Move the oldest objects of the thread's deque to the work packets, so that any thread can pick them up.
+	 * @param env[in] The GC thread
+	 * @param deque[in] The deque of the GC thread
+	 * @param shareCount[in] The number of objects to move
+	 */
+	void shareWorkDeque(MM_EnvironmentVLHGC *env, MM_WorkStealingDeque *deque, UDATA shareCount);
+
+	/**
+	 * Move every object left on the thread's deque to the work stack, so that the work survives the end of the task.
+	 * @param env[in] The GC thread
+	 */
+	void flushWorkDeque(MM_EnvironmentVLHGC *env);
+
 	/**
 	 * Called by the root scanner to scan all WeakReference objects discovered by the mark phase,
 	 * clearing and enqueuing them if necessary.
@@ -520,6 +582,9 @@ public:
 		, _interRegionRememberedSet(NULL)
 		, _collectStringConstantsEnabled(_extensions->collectStringConstants)
 		, _regionSize(_extensions->regionSize)
+		, _workDeques(NULL)
+		, _workDequeCount(0)
+		, _workPacketWaiters(0)
 	{
 		_typeId = __FUNCTION__;
 	}
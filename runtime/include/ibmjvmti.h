@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -100,6 +100,8 @@
 #define COM_IBM_REGISTER_TRACEPOINT_SUBSCRIBER "com.ibm.RegisterTracePointSubscriber"
 #define COM_IBM_DEREGISTER_TRACEPOINT_SUBSCRIBER "com.ibm.DeregisterTracePointSubscriber"
 
+#define COM_IBM_GET_EXCLUSIVE_ACCESS_HISTOGRAM "com.ibm.GetExclusiveAccessHistogram"
+
 #define COM_IBM_SHARED_CACHE_MODLEVEL_JAVA5 1
 #define COM_IBM_SHARED_CACHE_MODLEVEL_JAVA6 2
 #define COM_IBM_SHARED_CACHE_MODLEVEL_JAVA7 3
@@ -183,8 +185,9 @@ enum {
  */ 
 
 enum {
-	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID = 0,
-	COM_IBM_JLM_DUMP_FORMAT_TAGS      = 1
+	COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID   = 0,
+	COM_IBM_JLM_DUMP_FORMAT_TAGS        = 1,
+	COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY = 2
 };
 
 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2018 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -159,6 +159,11 @@ typedef struct J9ZipDirEntry {
 #define J9ZIPDIRENTRY_FILELIST(base) WSRP_GET((base)->fileList, struct J9ZipFileRecord*)
 #define J9ZIPDIRENTRY_DIRLIST(base) WSRP_GET((base)->dirList, struct J9ZipDirEntry*)
 
+typedef struct J9ZipIndexSlot {
+    IDATA dirOffset;
+    IDATA entryOffset;
+} J9ZipIndexSlot;
+
 typedef struct J9ZipCacheEntry {
     J9WSRP zipFileName;
     IDATA zipFileSize;
@@ -166,12 +171,16 @@ typedef struct J9ZipCacheEntry {
     IDATA startCentralDir;
     J9WSRP currentChunk;
     J9WSRP chunkActiveDir;
+    J9WSRP index;
+    UDATA indexSlotCount;
+    UDATA entryCount;
     struct J9ZipDirEntry root;
 } J9ZipCacheEntry;
 
 #define J9ZIPCACHEENTRY_ZIPFILENAME(base) WSRP_GET((base)->zipFileName, U_8*)
 #define J9ZIPCACHEENTRY_CURRENTCHUNK(base) WSRP_GET((base)->currentChunk, struct J9ZipChunkHeader*)
 #define J9ZIPCACHEENTRY_CHUNKACTIVEDIR(base) WSRP_GET((base)->chunkActiveDir, struct J9ZipDirEntry*)
+#define J9ZIPCACHEENTRY_INDEX(base) WSRP_GET((base)->index, struct J9ZipIndexSlot*)
 #define J9ZIPCACHEENTRY_NEXT(base) WSRP_GET((&((base)->root))->next, struct J9ZipDirEntry*)
 #define J9ZIPCACHEENTRY_FILELIST(base) WSRP_GET((&((base)->root))->fileList, struct J9ZipFileRecord*)
 #define J9ZIPCACHEENTRY_DIRLIST(base) WSRP_GET((&((base)->root))->dirList, struct J9ZipDirEntry*)
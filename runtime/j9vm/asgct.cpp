@@ -22,7 +22,6 @@
 
 #include "j9.h"
 #include "j9protos.h"
-#include "ut_j9scar.h"
 #include "rommeth.h"
 
 #if defined(LINUX) && defined(J9VM_ARCH_X86) && defined(J9VM_ENV_DATA64)
@@ -68,8 +67,22 @@ asyncFrameIterator(J9VMThread * currentThread, J9StackWalkState * walkState)
 {
 	ASGCT_CallFrame *frame = (ASGCT_CallFrame*)walkState->userData1;
 	J9Method *method = walkState->method;
-	J9JNIMethodID *methodID = currentThread->javaVM->internalVMFunctions->getJNIMethodID(currentThread, method);
-	Assert_SC_notNull(methodID);
+	/* Creating a method ID allocates and enters the JNI frame mutex, neither of which is allowed
+	 * in a signal handler, so only the existing IDs are used. Profilers create the IDs up front
+	 * by calling GetClassMethods from their ClassPrepare event.
+	 */
+	J9JNIMethodID *methodID = NULL;
+	void **jniIDs = J9_CLASS_FROM_METHOD(method)->jniIDs;
+	if (NULL != jniIDs) {
+		UDATA methodIndex = getMethodIndexUnchecked(method);
+		if (UDATA_MAX != methodIndex) {
+			methodID = (J9JNIMethodID*)jniIDs[methodIndex];
+		}
+	}
+	if (NULL == methodID) {
+		walkState->userData2 = (void*)(IDATA)ticks_no_class_load;
+		return J9_STACKWALK_STOP_ITERATING;
+	}
 	frame->method_id = (jmethodID)methodID;
 	J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
 	if (J9_ARE_ANY_BITS_SET(romMethod->modifiers, J9AccNative)) {
@@ -93,6 +106,11 @@ typedef struct {
 	void *ucontext;
 	J9VMThread *currentThread;
 	jint num_frames;
+	bool pushedResolveFrame;
+	UDATA *savedSP;
+	U_8 *savedPC;
+	J9Method *savedLiterals;
+	UDATA *savedArg0EA;
 } ASGCT_parms;
 
 static UDATA
@@ -102,6 +120,11 @@ protectedASGCT(J9PortLibrary *portLib, void *arg)
 	J9VMThread *currentThread = BFUjavaVM->internalVMFunctions->currentVMThread(BFUjavaVM);
 	if (NULL != currentThread) {
 		parms->currentThread = currentThread;
+		/* Classes may be unloaded or redefined while exclusive access is held, which frees the methods the walk would report */
+		if (J9_XACCESS_EXCLUSIVE == BFUjavaVM->exclusiveAccessState) {
+			parms->num_frames = ticks_GC_active;
+			return 0;
+		}
 		parms->num_frames = ticks_not_walkable_Java;
 		J9JITConfig *jitConfig = BFUjavaVM->jitConfig;
 		if (NULL != jitConfig) {
@@ -112,6 +135,14 @@ protectedASGCT(J9PortLibrary *portLib, void *arg)
 				J9JITExceptionTable *metaData = jitConfig->jitGetExceptionTableFromPC(currentThread, rip);
 				if (NULL != metaData) {
 					greg_t rsp = regs[REG_RSP];
+					/* The resolve frame overwrites the thread's saved stack state, which the
+					 * interrupted thread may still need, so it is restored by the caller.
+					 */
+					parms->savedSP = currentThread->sp;
+					parms->savedPC = currentThread->pc;
+					parms->savedLiterals = currentThread->literals;
+					parms->savedArg0EA = currentThread->arg0EA;
+					parms->pushedResolveFrame = true;
 					jitPushResolveFrame(currentThread, (UDATA*)rsp, (U_8*)rip);
 				}
 			}
@@ -129,10 +160,15 @@ protectedASGCT(J9PortLibrary *portLib, void *arg)
 			| J9_STACKWALK_RECORD_BYTECODE_PC_OFFSET | J9_STACKWALK_COUNT_SPECIFIED
 			| J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_NO_ERROR_REPORT;
 		walkState.userData1 = (void*)parms->trace->frames;
+		walkState.userData2 = NULL;
 		walkState.frameWalkFunction = asyncFrameIterator;
 		UDATA result = BFUjavaVM->walkStackFrames(currentThread, &walkState);
 		if (J9_STACKWALK_RC_NONE == result) {
-			parms->num_frames = (jint)walkState.framesWalked;
+			if (NULL != walkState.userData2) {
+				parms->num_frames = (jint)(IDATA)walkState.userData2;
+			} else {
+				parms->num_frames = (jint)walkState.framesWalked;
+			}
 		}
 	}
 	return 0;
@@ -147,7 +183,7 @@ void AsyncGetCallTrace(ASGCT_CallTrace *trace, jint depth, void *ucontext)
 #if defined(ASGCT_SUPPORTED)
 	if (NULL != BFUjavaVM) {
 		PORT_ACCESS_FROM_JAVAVM(BFUjavaVM);
-		ASGCT_parms parms = { trace, depth, ucontext, currentThread, num_frames };
+		ASGCT_parms parms = { trace, depth, ucontext, currentThread, num_frames, false, NULL, NULL, NULL, NULL };
 		UDATA result = 0;
 		j9sig_protect(
 				protectedASGCT, (void*)&parms, 
@@ -157,6 +193,12 @@ void AsyncGetCallTrace(ASGCT_CallTrace *trace, jint depth, void *ucontext)
 		num_frames = parms.num_frames;
 		currentThread = parms.currentThread;
 		if (NULL != currentThread) {
+			if (parms.pushedResolveFrame) {
+				currentThread->sp = parms.savedSP;
+				currentThread->pc = parms.savedPC;
+				currentThread->literals = parms.savedLiterals;
+				currentThread->arg0EA = parms.savedArg0EA;
+			}
 			currentThread->jitArtifactSearchCache = (void*)((UDATA)currentThread->jitArtifactSearchCache & ~(UDATA)J9_STACKWALK_NO_JIT_CACHE);
 		}
 	}
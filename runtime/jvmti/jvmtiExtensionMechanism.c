@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -114,6 +114,8 @@ static jvmtiError JNICALL jvmtiGetJ9method(jvmtiEnv *env, jmethodID mid, void **
 static jvmtiError JNICALL jvmtiRegisterTracePointSubscriber(jvmtiEnv *env, char *description, jvmtiTraceSubscriber subscriber, jvmtiTraceAlarm alarm, void *userData, void **subscriptionID, ...);
 static jvmtiError JNICALL jvmtiDeregisterTracePointSubscriber(jvmtiEnv *env, void *subscriptionID, ...);
 
+static jvmtiError JNICALL jvmtiGetExclusiveAccessHistogram(jvmtiEnv *env, jint max_buckets, jlong *counts_buffer, jint *bucket_count_ptr, jlong *max_response_micros_ptr, ...);
+
 /*
  * Struct to encapsulate the details of a verbose GC subscriber
  */
@@ -346,6 +348,14 @@ static const jvmtiParamInfo jvmtiDeregisterTracepointSubscriber_params[] = {
 	{ "subscriptionID", JVMTI_KIND_IN_PTR, JVMTI_TYPE_CVOID, JNI_FALSE }
 };
 
+/* (jvmtiEnv *env, jint max_buckets, jlong *counts_buffer, jint *bucket_count_ptr, jlong *max_response_micros_ptr) */
+static const jvmtiParamInfo jvmtiGetExclusiveAccessHistogram_params[] = {
+	{ "max_buckets", JVMTI_KIND_IN, JVMTI_TYPE_JINT, JNI_FALSE },
+	{ "counts_buffer", JVMTI_KIND_OUT_BUF, JVMTI_TYPE_JLONG, JNI_TRUE },
+	{ "bucket_count_ptr", JVMTI_KIND_OUT, JVMTI_TYPE_JINT, JNI_FALSE },
+	{ "max_response_micros_ptr", JVMTI_KIND_OUT, JVMTI_TYPE_JLONG, JNI_TRUE }
+};
+
 /*
  * Error lists for extended functions
  */
@@ -448,6 +458,12 @@ static const jvmtiError jvmtiGetTraceMetadata_errors[] = {
 	JVMTI_ERROR_INVALID_ENVIRONMENT
 };
 
+static const jvmtiError jvmtiGetExclusiveAccessHistogram_errors[] = {
+	JVMTI_ERROR_NULL_POINTER,
+	JVMTI_ERROR_ILLEGAL_ARGUMENT,
+	JVMTI_ERROR_WRONG_PHASE
+};
+
 static const jvmtiError jvmtiGetMemoryCategories_errors[] = {
 	JVMTI_ERROR_UNSUPPORTED_VERSION,
 	JVMTI_ERROR_ILLEGAL_ARGUMENT,
@@ -726,6 +742,13 @@ static const J9JVMTIExtensionFunctionInfo J9JVMTIExtensionFunctionInfoTable[] =
 		SIZE_AND_TABLE(jvmtiDeregisterTracepointSubscriber_params),
 		SIZE_AND_TABLE(jvmtiDeregisterTracePointSubscriber_errors)
 	},
+	{
+		(jvmtiExtensionFunction) jvmtiGetExclusiveAccessHistogram,
+		COM_IBM_GET_EXCLUSIVE_ACCESS_HISTOGRAM,
+		J9NLS_JVMTI_COM_IBM_GET_EXCLUSIVE_ACCESS_HISTOGRAM_DESCRIPTION,
+		SIZE_AND_TABLE(jvmtiGetExclusiveAccessHistogram_params),
+		SIZE_AND_TABLE(jvmtiGetExclusiveAccessHistogram_errors)
+	},
 };
 
 #define NUM_EXTENSION_FUNCTIONS (sizeof(J9JVMTIExtensionFunctionInfoTable) / sizeof(J9JVMTIExtensionFunctionInfoTable[0]))
@@ -2720,7 +2743,7 @@ jvmtiJlmDumpStats(jvmtiEnv* env, void ** dump_info, jint dump_format, ...)
 	ENSURE_PHASE_LIVE(env);
 	ENSURE_NON_NULL(dump_info);
 
-    if ( (dump_format < COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) || (dump_format > COM_IBM_JLM_DUMP_FORMAT_TAGS)) {
+    if ( (dump_format < COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) || (dump_format > COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY)) {
         rc = JVMTI_ERROR_ILLEGAL_ARGUMENT;
         goto done;
     }
@@ -3463,3 +3486,46 @@ jvmtiDeregisterTracePointSubscriber(jvmtiEnv* env, void *subscriberID, ...)
 	done:
 	TRACE_JVMTI_RETURN(jvmtiDeregisterTracePointSubscriber);
 }
+
+/**
+ * Get the histogram of the times taken by all threads to respond to exclusive VM access requests.
+ * Bucket i counts the requests which took less than 2^i microseconds, the last bucket counts all
+ * the longer requests.
+ *
+ * @param[in] env the jvmti env
+ * @param[in] max_buckets the number of elements in counts_buffer
+ * @param[out] counts_buffer receives the counts of the first max_buckets buckets, may be NULL if max_buckets is 0
+ * @param[out] bucket_count_ptr receives the number of buckets in the histogram
+ * @param[out] max_response_micros_ptr receives the longest response time in microseconds, may be NULL
+ * @return a jvmtiError code
+ */
+static jvmtiError JNICALL
+jvmtiGetExclusiveAccessHistogram(jvmtiEnv *env, jint max_buckets, jlong *counts_buffer, jint *bucket_count_ptr, jlong *max_response_micros_ptr, ...)
+{
+	J9JavaVM *vm = JAVAVM_FROM_ENV(env);
+	jvmtiError rc = JVMTI_ERROR_NONE;
+	UDATA i = 0;
+
+	Trc_JVMTI_jvmtiGetExclusiveAccessHistogram_Entry(env, max_buckets);
+
+	ENSURE_PHASE_START_OR_LIVE(env);
+	ENSURE_NON_NEGATIVE(max_buckets);
+	ENSURE_NON_NULL(bucket_count_ptr);
+	if (0 != max_buckets) {
+		ENSURE_NON_NULL(counts_buffer);
+	}
+
+	/* the histogram is updated by the exclusive access holder with the vmThreadListMutex held */
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	for (i = 0; (i < (UDATA)max_buckets) && (i < J9_XACCESS_RESPONSE_HISTOGRAM_BUCKETS); i++) {
+		counts_buffer[i] = (jlong)vm->exclusiveAccessResponseHistogram[i];
+	}
+	if (NULL != max_response_micros_ptr) {
+		*max_response_micros_ptr = (jlong)vm->exclusiveAccessMaxResponseTime;
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+	*bucket_count_ptr = J9_XACCESS_RESPONSE_HISTOGRAM_BUCKETS;
+
+done:
+	TRACE_JVMTI_RETURN(jvmtiGetExclusiveAccessHistogram);
+}
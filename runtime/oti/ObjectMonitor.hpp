@@ -554,6 +554,54 @@ done:
 		}
 	}
 
+	/**
+	 * Record the outcome of spinning on a flat lock of an instance of clazz.
+	 *
+	 * @param clazz[in] the object's J9Class
+	 * @param acquired[in] true if the lock was acquired by spinning, false if the thread has to block
+	 */
+	static VMINLINE void
+	recordSpinOutcome(J9Class *clazz, bool acquired)
+	{
+		/*
+		 * spinAcquiredCounter and spinFailedCounter are per class counters that track how often spinning on a flat lock
+		 * succeeds. They are updated without atomics, an occasional lost update only makes the history slightly less precise.
+		 */
+		U_16 spinAcquiredCounter = clazz->spinAcquiredCounter;
+		U_16 spinFailedCounter = clazz->spinFailedCounter;
+
+		/* If incrementing either counter would cause an overflow, first divide both counters by 2 so older history decays. */
+		if ((spinAcquiredCounter == (U_16)0xFFFF) || (spinFailedCounter == (U_16)0xFFFF)) {
+			spinAcquiredCounter >>= 1;
+			spinFailedCounter >>= 1;
+		}
+		if (acquired) {
+			spinAcquiredCounter += 1;
+		} else {
+			spinFailedCounter += 1;
+		}
+		clazz->spinAcquiredCounter = spinAcquiredCounter;
+		clazz->spinFailedCounter = spinFailedCounter;
+	}
+
+	/**
+	 * Determine whether spinning on flat locks of instances of clazz is unlikely to pay off, i.e. spinning mostly ends with
+	 * the thread blocking anyway. Threads contending on such locks skip the yield phase and inflate the lock sooner.
+	 *
+	 * @param clazz[in] the object's J9Class
+	 *
+	 * @return true if the spin should be shortened, false otherwise
+	 */
+	static VMINLINE bool
+	shouldShortenSpin(J9Class *clazz)
+	{
+		U_16 const spinAcquiredCounter = clazz->spinAcquiredCounter;
+		U_16 const spinFailedCounter = clazz->spinFailedCounter;
+
+		return ((UDATA)(spinAcquiredCounter + spinFailedCounter) >= J9_ADAPTIVE_SPIN_MIN_SAMPLES)
+				&& ((UDATA)spinFailedCounter > ((UDATA)spinAcquiredCounter * J9_ADAPTIVE_SPIN_FAILURE_RATIO));
+	}
+
 	/**
 	 * Determine initial lockword value based on reservedCounter and cancelCounter in the J9Class.
 	 *
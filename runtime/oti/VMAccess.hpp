@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -329,6 +329,7 @@ public:
 		if (timeTaken > slowTolerance) {
 			TRIGGER_J9HOOK_VM_SLOW_EXCLUSIVE(vm->hookInterface, currentThread, (UDATA) timeTaken, reason);
 		}
+		vm->exclusiveAccessLastResponseReason = reason;
 		omrthread_monitor_notify_all(vm->exclusiveAccessMutex);
 	}
 
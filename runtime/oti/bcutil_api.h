@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -159,6 +159,35 @@ IDATA
 bcutil_J9VMDllMain (J9JavaVM* vm, IDATA stage, void* reserved);
 
 
+/* ---------------- ROMClassPrebuilder.cpp ---------------- */
+
+/**
+* @brief Start the threads which prebuild the ROMClasses of bootstrap class path JARs
+* @param vm
+* @param threadCount number of prebuild threads, 0 disables prebuilding
+* @return 0 on success, -1 on failure
+*/
+IDATA
+startupROMClassPrebuilder(J9JavaVM *vm, UDATA threadCount);
+
+/**
+* @brief Stop the prebuild threads, report their statistics and free the unused prebuilt ROMClasses
+* @param vm
+* @return void
+*/
+void
+shutdownROMClassPrebuilder(J9JavaVM *vm);
+
+/**
+* @brief Queue the classes of a bootstrap class path JAR to be prebuilt
+* @param javaVM
+* @param cpEntry the opened JAR
+* @return void
+*/
+void
+j9bcutil_prebuildROMClasses(J9JavaVM *javaVM, J9ClassPathEntry *cpEntry);
+
+
 /* ---------------- cfreader.c ---------------- */
 
 /**
@@ -341,6 +341,7 @@ extern "C" {
 #define J9_EXTENDED_RUNTIME2_VALUE_BASED_WARNING 0x2000
 #define J9_EXTENDED_RUNTIME2_LOAD_HEALTHCENTER_MODULE 0x4000
 #define J9_EXTENDED_RUNTIME2_3164_INTEROPERABILITY 0x8000
+#define J9_EXTENDED_RUNTIME2_CRITICAL_JNI_NATIVES 0x10000
 
 #define J9_OBJECT_HEADER_AGE_DEFAULT 0xA /* OBJECT_HEADER_AGE_DEFAULT */
 #define J9_OBJECT_HEADER_SHAPE_MASK 0xE /* OBJECT_HEADER_SHAPE_MASK */
@@ -804,6 +805,19 @@ extern "C" {
 #define J9_XACCESS_HANDED_OFF 4
 #define J9_XACCESS_HANDING_OFF_FROM_EXTERNAL_THREAD 5
 
+/* bucket i of J9JavaVM.exclusiveAccessResponseHistogram counts requests which waited less than 2^i microseconds, the last bucket counts the rest */
+#define J9_XACCESS_RESPONSE_HISTOGRAM_BUCKETS 24
+
+/* spinning on flat locks of a class is shortened once J9_ADAPTIVE_SPIN_MIN_SAMPLES spins were recorded and
+ * failed spins outnumber acquired ones by more than J9_ADAPTIVE_SPIN_FAILURE_RATIO (see -Xthr:noAdaptiveSpinning) */
+#define J9_ADAPTIVE_SPIN_MIN_SAMPLES 64
+#define J9_ADAPTIVE_SPIN_FAILURE_RATIO 4
+
+/* bucket i of J9JavaVM.parkLatencyHistogram and unparkLatencyHistogram counts latencies of less than 2^i microseconds, the last bucket counts the rest */
+#define J9_PARK_LATENCY_HISTOGRAM_BUCKETS 24
+/* default -Xthr:parkSpinTime= in nanoseconds on multiprocessors */
+#define J9_PARK_SPIN_TIME_DEFAULT 20000
+
 #define J9_IDLE_TUNING_GC_ON_IDLE 0x1
 #define J9_IDLE_TUNING_COMPACT_ON_IDLE 0x2
 #define J9_IDLE_TUNING_IGNORE_UNRECOGNIZED_OPTIONS 0x4
@@ -38,7 +38,9 @@
 #define J9VM_MAX_HIDDEN_FIELDS_PER_CLASS 8
 
 #define J9VM_DLT_HISTORY_SIZE  16
-#define J9VM_OBJECT_MONITOR_CACHE_SIZE  32
+#define J9VM_OBJECT_MONITOR_CACHE_SIZE  64
+/* minimum number of monitor tables, each protected by its own mutex */
+#define J9VM_MONITOR_TABLE_MIN_COUNT  8
 #define J9VM_ASYNC_MAX_HANDLERS 32
 
 /* The bit fields used by verifyQualifiedName to verify a qualified class name */
@@ -1082,6 +1084,9 @@ typedef struct J9SharedClassJavacoreDataDescriptor {
 	UDATA corruptValue;
 	UDATA softMaxBytes;
 	UDATA otherBytes;
+	UDATA readMutexWaitCount;
+	UDATA writeMutexWaitMillis;
+	UDATA refreshMutexWaitCount;
 	/* The fields above are stats for the top layer, and the fields below are the summary for all layers */
 	UDATA ccCount;
 	UDATA ccStartedCount;
@@ -1188,12 +1193,12 @@ typedef struct J9SharedCacheHeader {
 	UDATA corruptValue;
 	UDATA lastMetadataType;
 	UDATA writerCount;
-	UDATA unused5;
-	UDATA unused6;
+	UDATA romClassIndexSRP;
+	UDATA readMutexWaitCount;
 	U_32 softMaxBytes;
-	UDATA unused8;
-	UDATA unused9;
-	UDATA unused10;
+	UDATA writeMutexWaitMillis;
+	UDATA refreshMutexWaitCount;
+	UDATA staleBytes;
 } J9SharedCacheHeader;
 
 #define J9SHAREDCACHEHEADER_UPDATECOUNTPTR(base) WSRP_GET((base)->updateCountPtr, UDATA*)
@@ -1241,6 +1246,13 @@ typedef struct J9SharedCacheAPI {
 	U_8 sharedCacheEnabled;
 	U_8 inContainer; /* It is TRUE only when xShareClassesPresent is FALSE and J9_SHARED_CACHE_DEFAULT_BOOT_SHARING(vm) is TRUE and the JVM is running in container */
 	I_8 layer;
+	UDATA reclaimStalePercent;
+	UDATA autoReclaimStalePercent;
+	U_8 hugePages;
+	U_8 prefault;
+	U_8 timestampWatch;
+	UDATA timestampCheckInterval;
+	U_8 shareZipCache;
 } J9SharedCacheAPI;
 
 typedef struct J9SharedClassConfig {
@@ -1543,6 +1555,9 @@ typedef struct J9DbgROMClassBuilder {
 	UDATA anonClassNameBufferSize;
 	U_8* bufferManagerBuffer;
 	struct J9DbgStringInternTable stringInternTable;
+	UDATA classFileHashLookupCount;
+	UDATA classFileHashAcceptedCount;
+	UDATA classFileHashRecordedCount;
 } J9DbgROMClassBuilder;
 
 typedef struct J9ROMFieldWalkState {
@@ -1836,12 +1851,14 @@ typedef struct J9TranslationBufferSet {
 	U_8* classFileError;
 	UDATA classFileSize;
 	void* romClassBuilder;
+	void* romClassPrebuilder;
 	IDATA  ( *findLocallyDefinedClassFunction)(struct J9VMThread * vmThread, struct J9Module * j9module, U_8 * className, U_32 classNameLength, struct J9ClassLoader * classLoader, struct J9ClassPathEntry * classPath, UDATA classPathEntryCount, UDATA options, struct J9TranslationLocalBuffer *localBuffer) ;
 	struct J9Class*  ( *internalDefineClassFunction)(struct J9VMThread* vmThread, void* className, UDATA classNameLength, U_8* classData, UDATA classDataLength, j9object_t classDataObject, struct J9ClassLoader* classLoader, j9object_t protectionDomain, UDATA options, struct J9ROMClass *existingROMClass, struct J9Class *hostClass, struct J9TranslationLocalBuffer *localBuffer) ;
 	I_32  ( *closeZipFileFunction)(struct J9VMInterface* vmi, struct VMIZipFile* zipFile) ;
 	void  ( *reportStatisticsFunction)(struct J9JavaVM * javaVM, struct J9ClassLoader* loader, struct J9ROMClass* romClass, struct J9TranslationLocalBuffer *localBuffer) ;
 	UDATA  ( *internalLoadROMClassFunction)(struct J9VMThread * vmThread, struct J9LoadROMClassData *loadData, struct J9TranslationLocalBuffer *localBuffer) ;
 	IDATA  ( *transformROMClassFunction)(struct J9JavaVM *javaVM, struct J9PortLibrary *portLibrary, struct J9ROMClass *romClass, U_8 **classData, U_32 *size) ;
+	void  ( *prebuildROMClassesFunction)(struct J9JavaVM *javaVM, struct J9ClassPathEntry *cpEntry) ;
 } J9TranslationBufferSet;
 
 #define BCU_UNUSED_2  2
@@ -3119,6 +3136,16 @@ typedef struct J9ROMImageHeader {
 #define J9ROMIMAGEHEADER_FIRSTCLASS(base) NNSRP_GET((base)->firstClass, struct J9ROMClass*)
 #define J9ROMIMAGEHEADER_AOTPOINTER(base) SRP_GET((base)->aotPointer, void*)
 
+/* Hash index by method name of the methods of a class with many methods, built lazily by searchClassForMethod.
+ * The header is followed by slotCount U_32 slots, each holding 1 + the index of a method in ramMethods, or 0 if empty.
+ */
+typedef struct J9MethodLookupIndex {
+	struct J9ROMClass* romClass;
+	UDATA slotCount;
+} J9MethodLookupIndex;
+
+#define J9METHODLOOKUPINDEX_SLOTS(index) ((U_32 *)((index) + 1))
+
 /* @ddr_namespace: map_to_type=J9ClassLocation */
 
 struct J9Class;
@@ -3168,9 +3195,8 @@ typedef struct J9Class {
 	UDATA castClassCache;
 	void** jniIDs;
 	UDATA lockOffset;
-#if defined(J9VM_ENV_DATA64)
-	U_32 paddingForGLRCounters; /* This is used to preserve alignment under 64 bit. */
-#endif /* defined(J9VM_ENV_DATA64) */
+	U_16 spinAcquiredCounter;
+	U_16 spinFailedCounter;
 	U_16 reservedCounter;
 	U_16 cancelCounter;
 	UDATA newInstanceCount;
@@ -3199,6 +3225,7 @@ typedef struct J9Class {
 #endif /* JAVA_SPEC_VERSION >= 11 */
 	struct J9FlattenedClassCache* flattenedClassCache;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9MethodLookupIndex* methodLookupIndex;
 } J9Class;
 
 /* Interface classes can never be instantiated, so the following fields in J9Class will not be used:
@@ -3256,9 +3283,8 @@ typedef struct J9ArrayClass {
 	UDATA castClassCache;
 	void** jniIDs;
 	UDATA lockOffset;
-#if defined(J9VM_ENV_DATA64)
-	U_32 paddingForGLRCounters; /* This is used to preserve alignment under 64 bit. */
-#endif /* defined(J9VM_ENV_DATA64) */
+	U_16 spinAcquiredCounter;
+	U_16 spinFailedCounter;
 	U_16 reservedCounter;
 	U_16 cancelCounter;
 	UDATA newInstanceCount;
@@ -3288,6 +3314,7 @@ typedef struct J9ArrayClass {
 	/* Added temporarily for consistency */
 	UDATA flattenedElementSize;
 	struct J9ClassHotFieldsInfo* hotFieldsInfo;
+	struct J9MethodLookupIndex* methodLookupIndex;
 } J9ArrayClass;
 
 
@@ -3348,6 +3375,7 @@ typedef struct J9ClassLoader {
 	struct J9HashTable* classRelationshipsHashTable;
 	struct J9Pool* hotFieldPool;
 	omrthread_monitor_t hotFieldPoolMutex; 
+	struct J9HashTable* criticalNativeHashTable;
 } J9ClassLoader;
 
 #define J9CLASSLOADER_SHARED_CLASSES_ENABLED  8
@@ -3626,10 +3654,14 @@ typedef struct J9JNIReferenceFrame {
 	UDATA type;
 	struct J9JNIReferenceFrame* previous;
 	void* references;
+	UDATA capacity;
+	UDATA poolCapacity;
 } J9JNIReferenceFrame;
 
 #define JNIFRAME_TYPE_USER  1
 #define JNIFRAME_TYPE_INTERNAL  0
+#define JNIFRAME_POOL_CACHE_SIZE  4
+#define JNIFRAME_POOL_CACHE_MAX_CAPACITY  256
 
 typedef struct J9Method {
 	U_8* bytecodes;
@@ -5037,6 +5069,13 @@ typedef struct J9VMThread {
 #endif /* OMR_GC_COMPRESSED_POINTERS */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	UDATA safePointCount;
+	volatile UDATA parkUnparkTime;
+	UDATA parkWakeLatency;
+	UDATA stackWalkMapsDecoded;
+	UDATA stackWalkMapsCacheHits;
+	struct J9Pool* jniReferencePoolCache[JNIFRAME_POOL_CACHE_SIZE];
+	UDATA jniReferencePoolCacheCapacity[JNIFRAME_POOL_CACHE_SIZE];
+	UDATA jniReferencePoolCacheCount;
 } J9VMThread;
 
 #define J9VMTHREAD_ALIGNMENT  0x100
@@ -5223,6 +5262,9 @@ typedef struct J9JavaVM {
 	UDATA processReferenceActive;
 	IDATA finalizeMainFlags;
 	UDATA exclusiveAccessResponseCount;
+	UDATA exclusiveAccessLastResponseReason;
+	U_64 exclusiveAccessResponseHistogram[J9_XACCESS_RESPONSE_HISTOGRAM_BUCKETS];
+	U_64 exclusiveAccessMaxResponseTime;
 	j9object_t destroyVMState;
 	omrthread_monitor_t segmentMutex;
 	omrthread_monitor_t jniFrameMutex;
@@ -5281,7 +5323,13 @@ typedef struct J9JavaVM {
 	UDATA thrMaxTryEnterYieldsBeforeBlocking;
 	UDATA thrNestedSpinning;
 	UDATA thrTryEnterNestedSpinning;
+	UDATA thrAdaptiveSpinning;
 	UDATA thrDeflationPolicy;
+	UDATA thrGCDeflatedMonitorCount;
+	UDATA thrParkSpinTime;
+	UDATA thrParkLatencyHistogram;
+	UDATA parkLatencyHistogram[J9_PARK_LATENCY_HISTOGRAM_BUCKETS];
+	UDATA unparkLatencyHistogram[J9_PARK_LATENCY_HISTOGRAM_BUCKETS];
 	UDATA gcOptions;
 	UDATA  ( *unhookVMEvent)(struct J9JavaVM *javaVM, UDATA eventNumber, void * currentHandler, void * oldHandler) ;
 	UDATA classLoadingMaxStack;
@@ -5320,7 +5368,7 @@ typedef struct J9JavaVM {
 	J9SidecarExitFunction * sidecarExitFunctions;
 	struct J9HashTable** monitorTables;
 	UDATA monitorTableCount;
-	omrthread_monitor_t monitorTableMutex;
+	omrthread_monitor_t* monitorTableMutexes;
 	struct J9MonitorTableListEntry* monitorTableList;
 	struct J9Pool* monitorTableListPool;
 	UDATA thrStaggerStep;
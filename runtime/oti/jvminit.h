@@ -364,6 +364,7 @@ enum INIT_STAGE {
 #define VMOPT_OPT_XXNOINTERLEAVEMEMORY "-XX:-InterleaveMemory"
 #define VMOPT_OPT_XXINTERLEAVEMEMORY "-XX:+InterleaveMemory"
 #define VMOPT_ROMMETHODSORTTHRESHOLD_EQUALS "-XX:ROMMethodSortThreshold="
+#define VMOPT_XXROMCLASSPREBUILDTHREADS_EQUALS "-XX:ROMClassPrebuildThreads="
 #define VMOPT_VALUEFLATTENINGTHRESHOLD_EQUALS "-XX:ValueTypeFlatteningThreshold="
 #define VMOPT_VTARRAYFLATTENING_EQUALS "-XX:+EnableArrayFlattening"
 #define VMOPT_VTDISABLEARRAYFLATTENING_EQUALS "-XX:-EnableArrayFlattening"
@@ -385,6 +386,8 @@ enum INIT_STAGE {
 #define VMOPT_XXDISABLEORIGINALJDK8HEAPSIZECOMPATIBILITY "-XX:-OriginalJDK8HeapSizeCompatibilityMode"
 #define VMOPT_XXDISABLELEGACYMANGLING "-XX:-UseLegacyJNINameEscaping"
 #define VMOPT_XXENABLELEGACYMANGLING "-XX:+UseLegacyJNINameEscaping"
+#define VMOPT_XXENABLECRITICALJNINATIVES "-XX:+CriticalJNINatives"
+#define VMOPT_XXDISABLECRITICALJNINATIVES "-XX:-CriticalJNINatives"
 
 #if defined(J9VM_ZOS_3164_INTEROPERABILITY)
 #define VMOPT_XXENABLE3164INTEROPERABILITY "-XX:+Enable3164Interoperability"
@@ -271,6 +271,16 @@ UDATA
 resolveNativeAddress(J9VMThread *currentThread, J9Method *nativeMethod, UDATA runtimeBind);
 
 
+/**
+* @brief Find the JavaCritical_ entrypoint recorded when a static native taking and returning only primitives was bound
+* @param currentThread
+* @param nativeMethod
+* @return void *, NULL if the native has no critical entrypoint or is not bound yet
+*/
+void *
+lookupCriticalNativeAddress(J9VMThread *currentThread, J9Method *nativeMethod);
+
+
 /* ---------------- classallocation.c ---------------- */
 
 /**
@@ -2143,6 +2153,15 @@ UDATA
 initializeMonitorTable(J9JavaVM* vm);
 
 
+/**
+* @brief Register the GC hook which deflates idle inflated object monitors at the end of global GCs, unless -Xthr:deflationPolicy=never.
+* @param vm
+* @return 0 on success, non-zero on failure
+*/
+UDATA
+initializeMonitorDeflation(J9JavaVM* vm);
+
+
 /**
 * @brief
 * @param vmStruct
@@ -4486,6 +4505,13 @@ threadParkImpl (J9VMThread* vmThread, IDATA timeoutIsEpochRelative, I_64 timeout
 void
 threadUnparkImpl (J9VMThread* vmThread, j9object_t threadObject);
 
+/**
+ * Hook "J9HOOK_VM_SHUTTING_DOWN" callback function, registered by -Xthr:parkLatencyHistogram.
+ * Prints the park and unpark latency histograms to stderr.
+ */
+void
+reportParkLatencyHistograms(J9HookInterface **hookInterface, UDATA eventNum, void *eventData, void *userData);
+
 /* -------------------- threadhelp.cpp ------------ */
 
 IDATA
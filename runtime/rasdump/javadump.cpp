@@ -487,11 +487,13 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 	CALL_PROTECT(writeMemorySection, _Error);
 
 	/* The monitor section is crash prone as objects mutate under it.
-	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutex ahead of the
-	 * thread lock as we will attempt to get it again for uninflated locks when calling getVMThreadRawState while looking
-	 * for waiting threads on any given monitor
+	 * Lock ordering imposed by the lock inflation path means that we have to get the monitorTableMutexes ahead of the
+	 * thread lock as we will attempt to get one of them again for uninflated locks when calling getVMThreadRawState while
+	 * looking for waiting threads on any given monitor. The mutexes are always taken in table order.
 	 */
-	omrthread_monitor_enter(_VirtualMachine->monitorTableMutex);
+	for (UDATA tableIndex = 0; tableIndex < _VirtualMachine->monitorTableCount; tableIndex++) {
+		omrthread_monitor_enter(_VirtualMachine->monitorTableMutexes[tableIndex]);
+	}
 	omrthread_t self = omrthread_self();
 	if (!omrthread_lib_try_lock(self)) {
 		/* got both locks so we shouldn't deadlock getting thread state */
@@ -506,7 +508,9 @@ JavaCoreDumpWriter::JavaCoreDumpWriter(
 			"1LKREGMONDUMP  JVM System Monitor Dump unavailable [locked]\n"
 			"NULL           ------------------------------------------------------------------------\n");
 	}
-	omrthread_monitor_exit(_VirtualMachine->monitorTableMutex);
+	for (UDATA tableIndex = _VirtualMachine->monitorTableCount; tableIndex > 0; tableIndex--) {
+		omrthread_monitor_exit(_VirtualMachine->monitorTableMutexes[tableIndex - 1]);
+	}
 
 	/* If request=preempt (for native stack collection) we attempt to acquire the mutex and note if we got it */
 	if (_Agent->requestMask & J9RAS_DUMP_DO_PREEMPT_THREADS) {
@@ -1842,7 +1846,7 @@ JavaCoreDumpWriter::writeNativeAllocator(const char * name, U_32 depth, BOOLEAN
 void
 JavaCoreDumpWriter::writeMonitorSection(void)
 {
-	/* The code calling this method must have taken the monitorTableMutex and the thread library monitor_mutex
+	/* The code calling this method must have taken the monitorTableMutexes and the thread library monitor_mutex
 	 * (in that order) prior to calling and must release those locks on return from this method.
 	 */
 	J9ThreadMonitor* monitor = NULL;
@@ -42,6 +42,15 @@ extern "C" {
 }
 
 /* Trace macros should be used if messages should be affected by verboseLevel */
+/* States of the prefault thread */
+#define PREFAULT_THREAD_NONE 0
+#define PREFAULT_THREAD_RUNNING 1
+#define PREFAULT_THREAD_STOP_REQUESTED 2
+#define PREFAULT_THREAD_DONE 3
+
+/* Number of pages touched by the prefault thread between checks for a stop request */
+#define PREFAULT_STOP_CHECK_PAGES 256
+
 #define CACHEMAP_TRACE(verboseLevel, nlsFlags, var1) if (_verboseFlags & verboseLevel) j9nls_printf(PORTLIB, nlsFlags, var1)
 #define CACHEMAP_TRACE1(verboseLevel, nlsFlags, var1, p1) if (_verboseFlags & verboseLevel) j9nls_printf(PORTLIB, nlsFlags, var1, p1)
 #define CACHEMAP_TRACE2(verboseLevel, nlsFlags, var1, p1, p2) if (_verboseFlags & verboseLevel) j9nls_printf(PORTLIB, nlsFlags, var1, p1, p2)
@@ -159,6 +168,12 @@ IDATA
 SH_CacheMap::enterRefreshMutex(J9VMThread* currentThread, const char* caller)
 {
 	IDATA rc;
+	omrthread_t owner = ((J9ThreadAbstractMonitor*)_refreshMutex)->owner;
+
+	if ((NULL != owner) && (omrthread_self() != owner)) {
+		/* Only a hint, the owner may exit the mutex before this thread enters it */
+		_ccHead->incRefreshMutexWaitCount();
+	}
 
 	if ((rc = enterReentrantLocalMutex(currentThread, _refreshMutex, "_refreshMutex", caller)) == 0) {
 		if (1 == ((J9ThreadAbstractMonitor*)_refreshMutex)->count) {
@@ -290,6 +305,8 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_isAssertEnabled = true;
 	_metadataReleased = false;
 	_ccPool = NULL;
+	_prefaultMutex = NULL;
+	_prefaultState = PREFAULT_THREAD_NONE;
 
 	_managers = SH_Managers::newInstance(vm, (SH_Managers *)allocPtr);
 
@@ -358,6 +375,16 @@ SH_CacheMap::cleanup(J9VMThread* currentThread)
 	
 	Trc_SHR_CM_cleanup_Entry(currentThread);
 
+	/* the prefault thread must be done with the cache memory before it is released */
+	stopPrefaultThread();
+	if (NULL != _prefaultMutex) {
+		omrthread_monitor_destroy(_prefaultMutex);
+		_prefaultMutex = NULL;
+	}
+	if (NULL != _tsm) {
+		_tsm->cleanup(currentThread);
+	}
+
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
 		walkManager->cleanup(currentThread);
@@ -444,6 +471,9 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 	SH_CompositeCacheImpl* ccNext = NULL;
 	SH_CompositeCacheImpl* ccPrevious = NULL;
 	bool isCacheUniqueIdStored = false;
+	U_64 startMinorFaults = 0;
+	U_64 startMajorFaults = 0;
+	bool hasFaultCounts = SH_OSCache::getPageFaultCounts(&startMinorFaults, &startMajorFaults);
 
 	_actualSize = (U_32)piconfig->sharedClassCacheSize;
 
@@ -483,6 +513,12 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 		/* start up _ccHead (the top layer cache) and then statrt its pre-requiste cache (ccNext). Contine to startup ccNext and its pre-requiste cache, util there is no more pre-requiste cache.
 		 *     _ccHead -------------> ccNext ---------> ccNext --------> ........---------> ccTail
 		 *   (top layer)          (middle layer)     (middle layer)      ........         (layer 0)
+		 *
+		 * The layers are started one after another: the pre-requisite of a layer is recorded in the layer itself, so it
+		 * is only known once that layer has been started. The layers are read into the hashtables from the lowest layer
+		 * up (see the loop from _ccTail below), as an upper layer may refer to items in the layers beneath it.
+		 * Only the top layer is writable at runtime, the lower layers are attached read-only, so new AOT and JIT data is
+		 * always stored in the top layer even if it only depends on classes from a lower layer.
 		 */
 
 		if (!isCcHead) {
@@ -671,8 +707,20 @@ error:
 		/* THREADING: We want the cache mutex here as we are reading all available data. Don't want updates happening as we read. */
 
 		if (ccToUse->enterWriteMutex(currentThread, false, fnName) == 0) {
+			if ((_ccHead == _ccTail) && J9_ARE_NO_BITS_SET(*runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS)) {
+				/* ROMClasses covered by a persisted index are added to the hashtables on demand instead of being read now */
+				const ShcItem* indexItem = ccToUse->getROMClassIndexItem();
+
+				if (NULL != indexItem) {
+					_rcm->attachROMClassIndex(currentThread, (BlockPtr)ccToUse->getCacheHeaderAddress(), (BlockPtr)ccToUse->getClassDebugDataStartAddress(), indexItem);
+				}
+			}
 			/* populate the hashtables */
+			I_64 readStartNanos = j9time_nano_time();
 			itemsRead = readCache(currentThread, ccToUse, -1, false);
+			if (0 <= itemsRead) {
+				ccToUse->setStartupReadStats((UDATA)itemsRead, (U_64)(j9time_nano_time() - readStartNanos) / 1000);
+			}
 			ccToUse->protectPartiallyFilledPages(currentThread);
 			/* Two reasons for moving the code to check for full cache from SH_CompositeCacheImpl::startup()
 			 * to SH_CacheMap::startup():
@@ -732,6 +780,20 @@ error:
 
 	updateROMSegmentList(currentThread, false, false);
 
+	if (hasFaultCounts) {
+		U_64 minorFaults = 0;
+		U_64 majorFaults = 0;
+
+		/* counted for the whole process, so other threads starting up at the same time add to the counts */
+		SH_OSCache::getPageFaultCounts(&minorFaults, &majorFaults);
+		minorFaults -= startMinorFaults;
+		majorFaults -= startMajorFaults;
+		Trc_SHR_CM_startup_PageFaults(currentThread, minorFaults, majorFaults);
+		CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_STARTUP_PAGE_FAULTS, minorFaults, majorFaults);
+	}
+
+	startPrefaultThread(currentThread);
+
 	Trc_SHR_CM_startup_ExitOK(currentThread);
 	return 0;
 }
@@ -1261,6 +1323,12 @@ SH_CacheMap::refreshHashtables(J9VMThread* currentThread, bool hasClassSegmentMu
 
 	_ccHead->updateRuntimeFullFlags(currentThread);
 
+	if (!isRefreshNeeded(currentThread, hasClassSegmentMutex)) {
+		/* Nothing to read: avoid serializing concurrent lookups on the refresh mutex */
+		Trc_SHR_CM_refreshHashtables_Exit(currentThread, itemsRead);
+		return itemsRead;
+	}
+
 	if (enterRefreshMutex(currentThread, "refreshHashtables")==0) {
 		itemsRead = readCacheUpdates(currentThread);
 		if ((UnitTest::CACHE_FULL_TEST != UnitTest::unitTest)
@@ -1292,6 +1360,41 @@ SH_CacheMap::refreshHashtables(J9VMThread* currentThread, bool hasClassSegmentMu
 	return itemsRead;
 }
 
+/**
+ * Check without entering the refresh mutex whether refreshHashtables() has any work to do.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] hasClassSegmentMutex  Whether the current thread holds the class segment mutex
+ *
+ * @return false if no cache has updates to read, the segments of this JVM reflect the cache and no other
+ * 			thread is refreshing the hashtables, true otherwise
+ */
+bool
+SH_CacheMap::isRefreshNeeded(J9VMThread* currentThread, bool hasClassSegmentMutex)
+{
+	SH_CompositeCacheImpl* cache = _ccHead;
+
+	while (NULL != cache) {
+		if (cache->isStarted() && (0 != cache->checkUpdates(currentThread))) {
+			return true;
+		}
+		cache = cache->getPrevious();
+	}
+	if (hasClassSegmentMutex && _ccHead->isStarted()) {
+		/* A previous refresh without the class segment mutex may have left ROMClasses out of the segment list */
+		J9MemorySegment* currentSegment = _ccHead->getCurrentROMSegment();
+		if ((NULL == currentSegment) || (currentSegment->heapAlloc < (U_8*)_ccHead->getSegmentAllocPtr())) {
+			return true;
+		}
+	}
+	if (!_ccHead->isMetadataSegmentCurrent() || _ccHead->isCacheCorrupt()) {
+		return true;
+	}
+	/* A thread which has consumed the updates may still be processing them, in which case wait for it in the refresh mutex */
+	VM_AtomicSupport::readBarrier();
+	return (NULL != ((J9ThreadAbstractMonitor*)_refreshMutex)->owner);
+}
+
 /* THREADING: Will only guarantee to return correct results with either cache read or write mutex held. No need for local mutex. */
 IDATA 
 SH_CacheMap::isStale(const ShcItem* item)
@@ -1335,6 +1438,43 @@ SH_CacheMap::getCacheAreaForDataType(J9VMThread* currentThread, UDATA dataType,
     return _ccHead;
 }
 
+/**
+ * Choose the layer which stores AOT code or JIT data for a ROMClass.
+ *
+ * The data belongs in the layer holding the ROMClass, so that every cache built on that layer can share it.
+ * Only the top layer can be written at runtime: adding to a lower layer would change the unique ID that the
+ * layers above it were created against, and they would be rejected at the next startup. Data for a ROMClass
+ * in a lower layer is therefore stored in the top layer, and the lower layer counts it in its statistics.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] romAddress  Address in the cache of the ROMClass or ROMMethod the data is for
+ * @param [in] resourceType  Type of the data
+ * @param [in] dataLength  Bytes required for the data
+ * @param [out] ownerLayer  The layer holding romAddress, or NULL if it is not in the cache
+ *
+ * @return The layer to store the data in, or NULL if there is none
+ *
+ * THREADING: Must have cache write mutex
+ */
+SH_CompositeCacheImpl*
+SH_CacheMap::getCacheAreaForROMClassResource(J9VMThread* currentThread, const void* romAddress, UDATA resourceType, UDATA dataLength, SH_CompositeCacheImpl** ownerLayer)
+{
+	SH_CompositeCacheImpl* cache = _ccHead;
+
+	*ownerLayer = NULL;
+	while (NULL != cache) {
+		if (cache->isAddressInCache(romAddress, false)) {
+			*ownerLayer = cache;
+			break;
+		}
+		cache = cache->getNext();
+	}
+	if ((NULL != *ownerLayer) && (_ccHead != *ownerLayer)) {
+		Trc_SHR_CM_getCacheAreaForROMClassResource_StoreAbove(currentThread, resourceType, romAddress, (I_32)(*ownerLayer)->getLayer(), (I_32)_ccHead->getLayer());
+	}
+	return getCacheAreaForDataType(currentThread, resourceType, dataLength);
+}
+
 void
 SH_CacheMap::updateAverageWriteHashTime(UDATA actualTimeMicros) 
 {
@@ -2726,6 +2866,7 @@ SH_CacheMap::findROMClass(J9VMThread* currentThread, const char* path, Classpath
 		/* Call updateROMSegmentList() to ensure that heapAlloc of the romClass segment is always updated to include the returned romClass */
 		updateROMSegmentList(currentThread, omrthread_monitor_owned_by_self(currentThread->javaVM->classMemorySegments->segmentMutex) != 0);
 		updateBytesRead(returnVal->romSize);		/* This is kind of inaccurate as the strings are all external to the ROMClass */
+		recordLayerHit(returnVal, false);
 		/* trace event is at level 1 and trace exit message is at level 2 as per CMVC 155318/157683 */
 		Trc_SHR_CM_findROMClass_Exit_Found_Event(currentThread, path, returnVal, locateResult.foundAtIndex, cp->getHelperID());
 		Trc_SHR_CM_findROMClass_Exit_Found(currentThread, path, returnVal, locateResult.foundAtIndex);
@@ -2752,6 +2893,7 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 	ShcItem* itemPtr = &item;
 	ShcItem* itemInCache = NULL;
 	SH_CompositeCacheImpl* cacheAreaForAllocate;
+	SH_CompositeCacheImpl* ownerLayer = NULL;
 
 	PORT_ACCESS_FROM_VMC(currentThread);
 	Trc_SHR_Assert_True(_ccHead->hasWriteMutex(currentThread));
@@ -2779,7 +2921,7 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 
 	_ccHead->initBlockData(&itemPtr, totalLength, resourceType);
 
-	cacheAreaForAllocate = getCacheAreaForDataType(currentThread, resourceType, _ccHead->getBytesRequiredForItemWithAlign(itemPtr, align, wrapperLength));
+	cacheAreaForAllocate = getCacheAreaForROMClassResource(currentThread, romAddress, resourceType, _ccHead->getBytesRequiredForItemWithAlign(itemPtr, align, wrapperLength), &ownerLayer);
 	if (!cacheAreaForAllocate) {
 		/* This may indicate size required is bigger than the cachelet size. */
 		/* TODO: In offline mode, should be fatal */
@@ -2830,6 +2972,9 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 
 	if (localRRM->storeNew(currentThread, itemInCache, cacheAreaForAllocate)) {
 		resultWrapper = (void*)ITEMDATA(itemInCache);
+		if ((NULL != ownerLayer) && (cacheAreaForAllocate != ownerLayer)) {
+			ownerLayer->incStoredAboveCount(TYPE_COMPILED_METHOD == resourceType);
+		}
 	}
 	cacheAreaForAllocate->commitUpdate(currentThread, false);
 
@@ -3218,11 +3363,161 @@ SH_CacheMap::findCompiledMethod(J9VMThread* currentThread, const J9ROMMethod* ro
 			updateAccessedShrCacheMetadataBounds(currentThread, (uintptr_t *) result);
 		}
 #endif /* !defined(J9ZOS390) && !defined(AIXPPC) */
+		recordLayerHit(result, true);
 	}
 
 	return result;
 }
 
+/**
+ * Start a thread which touches the ROMClass and metadata pages of every layer if -Xshareclasses:prefault
+ * is specified, so that the page faults are taken in the background rather than by the threads which
+ * first load classes or AOT methods from the cache. The metadata area holds the AOT code.
+ *
+ * @param [in] currentThread  The current thread
+ */
+void
+SH_CacheMap::startPrefaultThread(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	omrthread_t thread = NULL;
+
+	if ((0 == vm->sharedCacheAPI->prefault)
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS)
+		|| (NULL != _prefaultMutex)
+	) {
+		return;
+	}
+	if (0 != omrthread_monitor_init(&_prefaultMutex, 0)) {
+		_prefaultMutex = NULL;
+		return;
+	}
+	_prefaultState = PREFAULT_THREAD_RUNNING;
+	if (0 != vm->internalVMFunctions->createThreadWithCategory(&thread, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, 0,
+			prefaultThreadProc, this, J9THREAD_CATEGORY_SYSTEM_THREAD)
+	) {
+		_prefaultState = PREFAULT_THREAD_NONE;
+	}
+}
+
+/**
+ * Stop the prefault thread, if it is running, and wait for it to finish.
+ */
+void
+SH_CacheMap::stopPrefaultThread(void)
+{
+	if (NULL != _prefaultMutex) {
+		omrthread_monitor_enter(_prefaultMutex);
+		if (PREFAULT_THREAD_RUNNING == _prefaultState) {
+			_prefaultState = PREFAULT_THREAD_STOP_REQUESTED;
+		}
+		while (PREFAULT_THREAD_STOP_REQUESTED == _prefaultState) {
+			omrthread_monitor_wait(_prefaultMutex);
+		}
+		omrthread_monitor_exit(_prefaultMutex);
+	}
+}
+
+int J9THREAD_PROC
+SH_CacheMap::prefaultThreadProc(void* entryArg)
+{
+	SH_CacheMap* cacheMap = (SH_CacheMap*)entryArg;
+
+	cacheMap->prefaultCache();
+
+	omrthread_monitor_enter(cacheMap->_prefaultMutex);
+	cacheMap->_prefaultState = PREFAULT_THREAD_DONE;
+	omrthread_monitor_notify_all(cacheMap->_prefaultMutex);
+	omrthread_exit(cacheMap->_prefaultMutex);
+
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+	return 0;
+}
+
+/**
+ * Touch every page of the ROMClass and metadata areas of each layer, starting from the lowest layer.
+ * Only reads are done, so page protection and other JVMs writing to the cache are not affected.
+ */
+void
+SH_CacheMap::prefaultCache(void)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+	UDATA pageSize = j9vmem_supported_page_sizes()[0];
+	UDATA pagesTouched = 0;
+	I_64 startNanos = j9time_nano_time();
+	SH_CompositeCacheImpl* cache = _ccTail;
+	bool stopped = false;
+
+	while ((NULL != cache) && !stopped) {
+		if (cache->isStarted()) {
+			stopped = !prefaultRange(cache->getBaseAddress(), cache->getSegmentAllocPtr(), pageSize, &pagesTouched)
+					|| !prefaultRange(cache->getMetaAllocPtr(), cache->getClassDebugDataStartAddress(), pageSize, &pagesTouched);
+		}
+		cache = cache->getPrevious();
+	}
+
+	U_64 elapsedMillis = (U_64)(j9time_nano_time() - startNanos) / 1000000;
+	Trc_SHR_CM_prefaultCache_Done(pagesTouched, elapsedMillis, (UDATA)(stopped ? 1 : 0));
+	if (!stopped) {
+		CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PREFAULT_DONE, pagesTouched, _cacheName, elapsedMillis);
+	}
+}
+
+/**
+ * Touch the pages in [start, end).
+ *
+ * @param [in] start  Start of the range
+ * @param [in] end  End of the range
+ * @param [in] pageSize  OS page size
+ * @param [in,out] pagesTouched  Incremented for every page touched
+ *
+ * @return false if the prefault thread has been asked to stop, true otherwise
+ */
+bool
+SH_CacheMap::prefaultRange(const void* start, const void* end, UDATA pageSize, UDATA* pagesTouched)
+{
+	UDATA cursor = (UDATA)start;
+	UDATA count = 0;
+
+	if ((NULL == start) || (NULL == end)) {
+		return true;
+	}
+	while (cursor < (UDATA)end) {
+		(void)*(volatile const U_8*)cursor;
+		cursor = (cursor & ~(pageSize - 1)) + pageSize;
+		*pagesTouched += 1;
+		count += 1;
+		if ((0 == (count % PREFAULT_STOP_CHECK_PAGES)) && (PREFAULT_THREAD_RUNNING != _prefaultState)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * Count a ROMClass or AOT method found by this JVM against the layer holding it.
+ *
+ * @param [in] address  Address of the ROMClass or compiled method in the cache
+ * @param [in] isCompiledMethod  true if address is a compiled method, false if it is a ROMClass
+ */
+void
+SH_CacheMap::recordLayerHit(const void* address, bool isCompiledMethod)
+{
+	SH_CompositeCacheImpl* cache = _ccHead;
+
+	while (NULL != cache) {
+		if (cache->isAddressInCache(address, false)) {
+			if (isCompiledMethod) {
+				cache->incCompiledMethodHitCount();
+			} else {
+				cache->incROMClassHitCount();
+			}
+			break;
+		}
+		cache = cache->getNext();
+	}
+}
+
 /**
  * Record the minimum and maximum addresses accessed in the shared classes cache.
  * @param [in] metadataAddress address accessed in metadata
@@ -4309,7 +4604,13 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 	}
 	
 	if (_rcm && (_rcm->getState() == MANAGER_STATE_STARTED)) {
+		UDATA unloadedNonStale = 0;
+		UDATA unloadedStale = 0;
+
 		_rcm->getNumItems(NULL, &nonstale, &stale);
+		_rcm->getNumUnloadedIndexItems(NULL, &unloadedNonStale, &unloadedStale);
+		nonstale += unloadedNonStale;
+		stale += unloadedStale;
 		descriptor->numStaleClasses = stale;
 		descriptor->numROMClasses = stale + nonstale;
 		if (descriptor->numROMClasses > 0) {
@@ -4463,11 +4764,37 @@ SH_CacheMap::markItemStale(J9VMThread* currentThread, const ShcItem* item, bool
 	Trc_SHR_CM_markItemStale_Entry(currentThread, item);
 	Trc_SHR_Assert_True(_ccHead->hasWriteMutex(currentThread));
 
-	_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), isCacheLocked);
+	_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), isCacheLocked, getStaleSegmentBytes(currentThread, item));
 
 	Trc_SHR_CM_markItemStale_Exit(currentThread, item);
 } 
 
+/**
+ * Get the number of bytes outside the metadata area which become stale with an item.
+ * A ROMClass may be referred to by several ROMClass items, so its size is only counted
+ * when the last non-stale item which refers to it is marked stale.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] item  The item being marked stale
+ *
+ * @return The size of the ROMClass of a ROMClass item, 0 for other items
+ * or while the ROMClass is still used by another item
+ */
+UDATA
+SH_CacheMap::getStaleSegmentBytes(J9VMThread* currentThread, const ShcItem* item)
+{
+	UDATA itemType = ITEMTYPE(item);
+
+	if ((TYPE_ROMCLASS == itemType) || (TYPE_SCOPED_ROMCLASS == itemType)) {
+		J9ROMClass* romClass = (J9ROMClass*)getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(item))->romClassOffset));
+
+		if ((NULL != romClass) && !_rcm->isROMClassUsedByOtherItem(currentThread, romClass, item)) {
+			return romClass->romSize;
+		}
+	}
+	return 0;
+}
+
 /* THREADING: This must always be called with write mutex OR read mutex held. If the
  * read mutex is held, it is released.
  */
@@ -4488,11 +4815,11 @@ SH_CacheMap::markItemStaleCheckMutex(J9VMThread* currentThread, const ShcItem* i
 		if (!isCacheLocked) {
 			_ccHead->doLockCache(currentThread);		/* Wait till all readers stop and unprotect metadata area */
 		}
-		_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), true);
+		_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), true, getStaleSegmentBytes(currentThread, item));
 	} else {
 		_ccHead->exitReadMutex(currentThread, fnName);
 		if (_ccHead->enterWriteMutex(currentThread, true, fnName) == 0) {
-			_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), true);
+			_ccHead->markStale(currentThread, (BlockPtr)ITEMEND(item), true, getStaleSegmentBytes(currentThread, item));
 			_ccHead->exitWriteMutex(currentThread, fnName);
 		} else {
 			Trc_SHR_CM_markItemStaleCheckMutex_Failed(currentThread, item);
@@ -5052,6 +5379,9 @@ SH_CacheMap::printCacheStatsTopLayerStatsHelper(J9VMThread* currentThread, UDATA
 		CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_DEBUGAREA_USED_BYTES, javacoreData->debugAreaLineNumberTableBytes + javacoreData->debugAreaLocalVariableTableBytes);
 	}
 	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_DEBUGAREA_USED, javacoreData->debugAreaUsed);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_READ_MUTEX_WAITS, javacoreData->readMutexWaitCount);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_WRITE_MUTEX_WAIT_MILLIS, javacoreData->writeMutexWaitMillis);
+	CACHEMAP_FMTPRINT1(J9NLS_DO_NOT_PRINT_MESSAGE_TAG, J9NLS_SHRC_CM_PRINTSTATS_REFRESH_MUTEX_WAITS, javacoreData->refreshMutexWaitCount);
 }
 /*
  * Helper funtion to print the statistics summary of the top layer cache.
@@ -5250,6 +5580,42 @@ SH_CacheMap::printShutdownStats(void)
 	
 	CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_READ_STORED, bytesRead, bytesStored);
 	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_UNSTORED_V1, softmxUnstoredBytes, maxAOTUnstoredBytes, maxJITUnstoredBytes);
+
+	if (NULL != _tsm) {
+		UDATA fileChecks = 0;
+		UDATA fileChecksAvoided = 0;
+
+		_tsm->getStatistics(&fileChecks, &fileChecksAvoided);
+		if (0 != (fileChecks + fileChecksAvoided)) {
+			CACHEMAP_TRACE2(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_TIMESTAMP_CHECKS, fileChecks, fileChecksAvoided);
+		}
+	}
+
+	/* Per-layer hit rates show whether lookups are satisfied by the lower layers or fall through to the top layer */
+	cache = _ccTail;
+	while (NULL != cache) {
+		if (cache->isStarted()) {
+			UDATA romClassHits = 0;
+			UDATA compiledMethodHits = 0;
+			UDATA startupItemsRead = 0;
+			U_64 startupReadMicros = 0;
+			UDATA compiledMethodsStoredAbove = 0;
+			UDATA jitDataStoredAbove = 0;
+			I_32 layer = (I_32)cache->getLayer();
+
+			cache->getLayerHitStats(&romClassHits, &compiledMethodHits, &startupItemsRead, &startupReadMicros);
+			cache->getStoredAboveStats(&compiledMethodsStoredAbove, &jitDataStoredAbove);
+			Trc_SHR_CM_printShutdownStats_LayerStats(layer, romClassHits, compiledMethodHits, startupItemsRead, startupReadMicros);
+			Trc_SHR_CM_printShutdownStats_LayerStoredAbove(layer, compiledMethodsStoredAbove, jitDataStoredAbove);
+			if (_ccHead != _ccTail) {
+				CACHEMAP_TRACE4(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_LAYER_HITS, layer, romClassHits, compiledMethodHits, startupReadMicros / 1000);
+				if (0 != (compiledMethodsStoredAbove + jitDataStoredAbove)) {
+					CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_LAYER_STORED_ABOVE, layer, compiledMethodsStoredAbove, jitDataStoredAbove);
+				}
+			}
+		}
+		cache = cache->getPrevious();
+	}
 }
 
 /**
@@ -5262,7 +5628,11 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	SH_Managers::ManagerWalkState state;
 	SH_CompositeCacheImpl* cache = _ccHead;
 
+	stopPrefaultThread();
+
 	printShutdownStats();
+
+	storeROMClassIndex(currentThread);
 	
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
@@ -5276,6 +5646,65 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	}
 }
 
+/**
+ * Persist an index of the ROMClasses in the cache, so that JVMs starting up later do not have to add
+ * every ROMClass to their hashtables while reading the cache. The index is only built for a single layer cache,
+ * once enough ROMClasses had to be read by this JVM (see SH_ROMClassManagerImpl::getROMClassIndexBytes()).
+ *
+ * @param[in] currentThread The current thread
+ */
+void
+SH_CacheMap::storeROMClassIndex(J9VMThread* currentThread)
+{
+	const char* fnName = "storeROMClassIndex";
+	SH_ByteDataManager* localBDM = NULL;
+	UDATA indexBytes = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((NULL == _ccHead)
+		|| (_ccHead != _ccTail)
+		|| _ccHead->isRunningReadOnly()
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_STATS | RUNTIME_FLAGS_PREVENT_BLOCK_DATA_UPDATE)
+		|| (NULL == _rcm)
+		|| (MANAGER_STATE_STARTED != _rcm->getState())
+		|| (NULL == (localBDM = getByteDataManager(currentThread)))
+	) {
+		return;
+	}
+
+	if (_ccHead->enterWriteMutex(currentThread, false, fnName) != 0) {
+		return;
+	}
+	/* The hashtables must be up to date with the cache so that every item above the boundary is in the index */
+	if (runEntryPointChecks(currentThread, NULL, NULL) != -1) {
+		indexBytes = _rcm->getROMClassIndexBytes(currentThread);
+	}
+	if (0 != indexBytes) {
+		U_8* indexBuffer = (U_8*)j9mem_allocate_memory(indexBytes, J9MEM_CATEGORY_CLASSES);
+
+		if (NULL != indexBuffer) {
+			BlockPtr boundary = (BlockPtr)_ccHead->getMetaAllocPtr();
+
+			if (_rcm->writeROMClassIndex(currentThread, (BlockPtr)_ccHead->getCacheHeaderAddress(), boundary, indexBuffer, indexBytes)) {
+				J9SharedDataDescriptor data;
+				BlockPtr indexInCache = NULL;
+
+				data.address = indexBuffer;
+				data.length = indexBytes;
+				data.type = J9SHR_DATA_TYPE_VM;
+				data.flags = J9SHRDATA_NOT_INDEXED;
+				indexInCache = addByteDataToCache(currentThread, localBDM, NULL, &data, NULL, false);
+				if (NULL != indexInCache) {
+					_ccHead->setROMClassIndexItem(currentThread, (const ShcItem*)(indexInCache - sizeof(ShcItem)));
+					Trc_SHR_CM_storeROMClassIndex_Stored(currentThread, indexInCache, indexBytes);
+				}
+			}
+			j9mem_free_memory(indexBuffer);
+		}
+	}
+	_ccHead->exitWriteMutex(currentThread, fnName);
+}
+
 /* Note: className can be NULL and if not, is not necessarily null-terminated */
 /* THREADING: Can be called multi-threaded */
 IDATA /*static */
@@ -6554,6 +6983,20 @@ SH_CacheMap::tryAdjustMinMaxSizes(J9VMThread* currentThread, bool isJCLCall)
 	return _ccHead->tryAdjustMinMaxSizes(currentThread, isJCLCall);
 }
 
+/* Compact the cache if enough of it is held by stale data.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ * @param [in] reclaimStalePercent The percentage of the used space that must be held by stale data
+ * @param [in] isUtility True for the reclaimStale= utility, false for autoReclaimStale=
+ *
+ * @return IDATA The number of bytes reclaimed, 0 if the cache has not been compacted, -1 on failure
+ */
+IDATA
+SH_CacheMap::reclaimStaleSpace(J9VMThread* currentThread, UDATA reclaimStalePercent, bool isUtility)
+{
+	return _ccHead->reclaimStaleSpace(currentThread, reclaimStalePercent, isUtility);
+}
+
 /* Update the runtime cache full flags according to cache full flags in the cache header
  *
  * @param [in] currentThread Pointer to J9VMThread structure for the current thread
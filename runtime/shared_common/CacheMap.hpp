@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -269,6 +269,8 @@ public:
 
 	I_32 tryAdjustMinMaxSizes(J9VMThread* currentThread, bool isJCLCall = false);
 
+	IDATA reclaimStaleSpace(J9VMThread* currentThread, UDATA reclaimStalePercent, bool isUtility);
+
 	void updateRuntimeFullFlags(J9VMThread* currentThread);
 
 	void increaseTransactionUnstoredBytes(U_32 segmentAndDebugBytes, J9SharedClassTransaction* obj);
@@ -322,6 +324,10 @@ private:
 	J9Pool* _ccPool;
 	bool _metadataReleased;
 
+	/* Background prefault of the cache pages, see startPrefaultThread() */
+	omrthread_monitor_t _prefaultMutex;
+	volatile UDATA _prefaultState;
+
 	bool _isAssertEnabled; /* flag to turn on/off assertion before acquiring local mutex */
 	
 	SH_Managers * _managers;
@@ -332,8 +338,26 @@ private:
 
 	IDATA readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, IDATA expectedUpdates, bool startupForStats);
 
+	void storeROMClassIndex(J9VMThread* currentThread);
+
 	IDATA refreshHashtables(J9VMThread* currentThread, bool hasClassSegmentMutex);
 
+	bool isRefreshNeeded(J9VMThread* currentThread, bool hasClassSegmentMutex);
+
+	void recordLayerHit(const void* address, bool isCompiledMethod);
+
+	void startPrefaultThread(J9VMThread* currentThread);
+
+	void stopPrefaultThread(void);
+
+	void prefaultCache(void);
+
+	bool prefaultRange(const void* start, const void* end, UDATA pageSize, UDATA* pagesTouched);
+
+	static int J9THREAD_PROC prefaultThreadProc(void* entryArg);
+
+	UDATA getStaleSegmentBytes(J9VMThread* currentThread, const ShcItem* item);
+
 	ClasspathWrapper* addClasspathToCache(J9VMThread* currentThread, ClasspathItem* obj);
 
 	const J9UTF8* addScopeToCache(J9VMThread* currentThread, const J9UTF8* scope, U_16 type = TYPE_SCOPE); 
@@ -391,6 +415,8 @@ private:
 
 	SH_CompositeCacheImpl* getCacheAreaForDataType(J9VMThread* currentThread, UDATA dataType, UDATA dataLength);
 
+	SH_CompositeCacheImpl* getCacheAreaForROMClassResource(J9VMThread* currentThread, const void* romAddress, UDATA resourceType, UDATA dataLength, SH_CompositeCacheImpl** ownerLayer);
+
 	IDATA startManager(J9VMThread* currentThread, SH_Manager* manager);
 
 	SH_ScopeManager* getScopeManager(J9VMThread* currentThread);
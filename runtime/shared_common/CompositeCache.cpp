@@ -30,6 +30,7 @@
 #include "j9protos.h"
 #include "j9shrnls.h"
 #include "jvminit.h"
+#include "romclasswalk.h"
 #include "shrinit.h"
 #include "ut_j9shr.h"
 
@@ -156,9 +157,10 @@ SH_CompositeCacheImpl::SH_SharedCacheHeaderInit::init(BlockPtr data, U_32 len, I
 	ca->writerCount = 0;
 	ca->softMaxBytes = softMaxBytes;
 	ca->cacheFullFlags = 0;
-	ca->unused8 = 0;
-	ca->unused9 = 0;
-	ca->unused10 = 0;
+	ca->readMutexWaitCount = 0;
+	ca->writeMutexWaitMillis = 0;
+	ca->refreshMutexWaitCount = 0;
+	ca->staleBytes = 0;
 	/* Note that the updateCountLockWord is only ever used single threaded, so no need to dereference this */
 	WSRP_SET(ca->updateCountPtr, &(ca->updateCount));
 	WSRP_SET(ca->corruptFlagPtr, &(ca->corruptFlag));
@@ -212,6 +214,17 @@ SH_CompositeCacheImpl::commonInit(J9JavaVM* vm)
 	_runtimeFlagsProtectMutex = NULL;
 	_readOnlyOSCache = false;
 	_readOnlyReaderCount = 0;
+	_localReaderMutex = NULL;
+	_localReaderCount = 0;
+	_readMutexWaitCount = 0;
+	_writeMutexWaitNanos = 0;
+	_refreshMutexWaitCount = 0;
+	_romClassHitCount = 0;
+	_compiledMethodHitCount = 0;
+	_compiledMethodsStoredAbove = 0;
+	_jitDataStoredAbove = 0;
+	_startupItemsRead = 0;
+	_startupReadMicros = 0;
 	_readWriteProtectCntr = 0;
 	_headerProtectCntr = 1;		/* Initialize to 1 indicating "unprotected" */
 	_readWriteAreaHeaderIsReadOnly = false;
@@ -410,6 +423,9 @@ SH_CompositeCacheImpl::cleanup(J9VMThread* currentThread)
 		if (_runtimeFlagsProtectMutex) {
 			omrthread_monitor_destroy(_runtimeFlagsProtectMutex);
 		}
+		if (_localReaderMutex) {
+			omrthread_monitor_destroy(_localReaderMutex);
+		}
 	} else if (_utMutex) {
 		omrthread_monitor_destroy(_utMutex);
 	}
@@ -981,6 +997,11 @@ SH_CompositeCacheImpl::startup(J9VMThread* currentThread, J9SharedClassPreinitCo
 		Trc_SHR_CC_startup_Exit11(currentThread);
 		return CC_STARTUP_FAILED;
 	}
+
+	if (0 != omrthread_monitor_init(&_localReaderMutex, 0)) {
+		Trc_SHR_CC_startup_Exit12(currentThread);
+		return CC_STARTUP_FAILED;
+	}
 	
 	if (isFirstStart) {
 		_commonCCInfo->cacheIsCorrupt = 0;
@@ -1896,6 +1917,9 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasReadWriteMutexThread);
 	Trc_SHR_Assert_NotEquals(currentThread, _commonCCInfo->hasRefreshMutexThread);
 
+	PORT_ACCESS_FROM_PORT(_portlib);
+	I_64 waitStartNanos = j9time_nano_time();
+
 	if (oscacheToUse) {
 		rc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID);
 	} else {
@@ -1903,6 +1927,8 @@ SH_CompositeCacheImpl::enterWriteMutex(J9VMThread* currentThread, bool lockCache
 	}
 	if (rc == 0) {
 		_commonCCInfo->hasWriteMutexThread = currentThread;
+		/* only updated by the thread holding the write mutex */
+		_writeMutexWaitNanos += (U_64)(j9time_nano_time() - waitStartNanos);
 		if (*_runtimeFlags & J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES) {
 			/*Pass doDecWriteCounter=false b/c exitWriteMutex is being called without updating writerCount*/
 			exitWriteMutex(currentThread, fname, false);
@@ -2272,6 +2298,70 @@ SH_CompositeCacheImpl::decReaderCount(J9VMThread* currentThread)
 	Trc_SHR_CC_decReaderCount_Exit(_theca->readerCount);
 }
 
+/**
+ * Register a thread of this JVM as a reader of the cache.
+ *
+ * Only the first reader of this JVM increments the readerCount in the cache header, so that
+ * concurrent readers within a JVM do not all contend on the shared counter and the header page protection.
+ * The cache cannot be locked while the JVM is registered in the shared readerCount.
+ *
+ * THREADING: The readerCount in the cache header must be incremented before _localReaderCount becomes non-zero,
+ * as readers finding a non-zero _localReaderCount rely on that registration.
+ *
+ * @param [in] currentThread  Pointer to J9VMThread structure for the current thread
+ */
+void
+SH_CompositeCacheImpl::incLocalReaderCount(J9VMThread* currentThread)
+{
+	UDATA oldNum = _localReaderCount;
+
+	/* Fast path: another reader of this JVM already holds the registration */
+	while (0 != oldNum) {
+		UDATA result = VM_AtomicSupport::lockCompareExchange((UDATA*)&_localReaderCount, oldNum, oldNum + 1);
+		if (result == oldNum) {
+			return;
+		}
+		oldNum = result;
+	}
+
+	/* A zero _localReaderCount can only change while holding _localReaderMutex */
+	omrthread_monitor_enter(_localReaderMutex);
+	if (0 == _localReaderCount) {
+		incReaderCount(currentThread);
+	}
+	VM_AtomicSupport::add((UDATA*)&_localReaderCount, 1);
+	omrthread_monitor_exit(_localReaderMutex);
+}
+
+/**
+ * Unregister a thread of this JVM as a reader of the cache.
+ *
+ * The last reader of this JVM decrements the readerCount in the cache header.
+ *
+ * @param [in] currentThread  Pointer to J9VMThread structure for the current thread
+ */
+void
+SH_CompositeCacheImpl::decLocalReaderCount(J9VMThread* currentThread)
+{
+	UDATA oldNum = _localReaderCount;
+
+	/* Fast path: other readers of this JVM keep the registration */
+	while (oldNum > 1) {
+		UDATA result = VM_AtomicSupport::lockCompareExchange((UDATA*)&_localReaderCount, oldNum, oldNum - 1);
+		if (result == oldNum) {
+			return;
+		}
+		oldNum = result;
+	}
+
+	omrthread_monitor_enter(_localReaderMutex);
+	/* The fast path of incLocalReaderCount() may still race with this decrement */
+	if (0 == VM_AtomicSupport::subtract((UDATA*)&_localReaderCount, 1)) {
+		decReaderCount(currentThread);
+	}
+	omrthread_monitor_exit(_localReaderMutex);
+}
+
 /**
  * Enter mutex to read data from the cache.
  *
@@ -2317,14 +2407,15 @@ SH_CompositeCacheImpl::enterReadMutex(J9VMThread* currentThread, const char* cal
 	/* THREADING: Important to increment readerCount before checking isLocked(), as the incremented
 	 * reader count prevents a lock from occurring.
 	 */
-	incReaderCount(currentThread);
+	incLocalReaderCount(currentThread);
 
 	if (isLocked()) {
 		/* If cache is locked, wait on mutex which will be owned by thread which called for the lock */
 		SH_OSCache* oscacheToUse = ((_ccHead == NULL) ? _oscache : _ccHead->_oscache);
 
 		/* Decrement the count before waiting for the write lock. */
-		decReaderCount(currentThread);
+		decLocalReaderCount(currentThread);
+		VM_AtomicSupport::add((UDATA*)&_readMutexWaitCount, 1);
 
 		Trc_SHR_CC_enterReadMutex_WaitOnGlobalMutex(currentThread, caller);
 		if (oscacheToUse) {
@@ -2335,7 +2426,7 @@ SH_CompositeCacheImpl::enterReadMutex(J9VMThread* currentThread, const char* cal
 		if (rc == 0) {
 			/* THREADING: Important to increment readerCount before exiting mutex, otherwise writer could
 				get a cache lock and think that all readers have finished */
-			incReaderCount(currentThread);
+			incLocalReaderCount(currentThread);
 
 			/* Once lock is released, fall through and exit mutex */
 			Trc_SHR_CC_enterReadMutex_ReleasingGlobalMutex(currentThread, caller);
@@ -2347,7 +2438,7 @@ SH_CompositeCacheImpl::enterReadMutex(J9VMThread* currentThread, const char* cal
 			if (rc != 0) {
 				PORT_ACCESS_FROM_PORT(_portlib);
 				CC_ERR_TRACE1(J9NLS_SHRC_CC_FAILED_EXIT_MUTEX, rc);
-				decReaderCount(currentThread);
+				decLocalReaderCount(currentThread);
 			}
 		}
 	}
@@ -2386,7 +2477,7 @@ SH_CompositeCacheImpl::exitReadMutex(J9VMThread* currentThread, const char* call
 		Trc_SHR_Assert_True(hasReadMutex(currentThread));
 	}
 
-	decReaderCount(currentThread);
+	decLocalReaderCount(currentThread);
 	currentThread->privateFlags2 &= ~J9_PRIVATE_FLAGS2_IN_SHARED_CACHE_READ_MUTEX;
 	Trc_SHR_CC_exitReadMutex_Exit(currentThread, caller);
 }
@@ -3102,15 +3193,18 @@ SH_CompositeCacheImpl::commitUpdate(J9VMThread* currentThread, bool isCachelet)
  * 
  * @param [in] blockEnd  Address of block to mark stale.  Need to pass pointer to first byte after end of block.
  * @param [in] isCacheLocked  Should be true if cache is locked
+ * @param [in] segmentBytes  Bytes of segment (ROMClass) data which become stale with the block, added with
+ * 			the length of the block to the stale bytes recorded in the cache header
  *
  * @pre The calling function needs to hold the writeMutex before calling this function
  */
 void
-SH_CompositeCacheImpl::markStale(J9VMThread* currentThread, BlockPtr blockEnd, bool isCacheLocked)
+SH_CompositeCacheImpl::markStale(J9VMThread* currentThread, BlockPtr blockEnd, bool isCacheLocked, UDATA segmentBytes)
 {
 	ShcItemHdr* ih = (ShcItemHdr*)(blockEnd);
 	BlockPtr areaStart = NULL;
 	UDATA areaLength = 0;
+	bool wasStale = false;
 
 	if (!_started || _readOnlyOSCache) {
 		Trc_SHR_Assert_ShouldNeverHappen();
@@ -3118,6 +3212,7 @@ SH_CompositeCacheImpl::markStale(J9VMThread* currentThread, BlockPtr blockEnd, b
 	}
 	Trc_SHR_Assert_Equals(currentThread, _commonCCInfo->hasWriteMutexThread);
 	Trc_SHR_CC_markStale_Event(currentThread, ih);
+	wasStale = (0 != CCITEMSTALE(ih));
 
 	if (0 != _theca->crcValid) {
 		/* _theca->crcValid is set to 0 when locking the cache. isCacheLocked cannot be true here */
@@ -3145,6 +3240,13 @@ SH_CompositeCacheImpl::markStale(J9VMThread* currentThread, BlockPtr blockEnd, b
 
 	CCSETITEMSTALE(ih);
 
+	if (!wasStale) {
+		/* Space which is reclaimed if the cache is compacted, see reclaimStaleSpace() */
+		unprotectHeaderReadWriteArea(currentThread, false);
+		_theca->staleBytes += CCITEMLEN(ih) + segmentBytes;
+		protectHeaderReadWriteArea(currentThread, false);
+	}
+
 	/* If the cache is locked, don't re-protect the page as the whole area remains unprotected. 
 	 * Also, don't re-protect the page if we're not done modifying it. */
 	if (_doMetaProtect && !isCacheLocked && ((UDATA)areaStart > (UDATA)_prevScan)) {
@@ -3157,6 +3259,711 @@ SH_CompositeCacheImpl::markStale(J9VMThread* currentThread, BlockPtr blockEnd, b
 	}
 }
 
+/**
+ * Check whether enough of the cache is held by stale data to compact the cache.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] reclaimStalePercent  Value of the -Xshareclasses:reclaimStale= or autoReclaimStale= option
+ *
+ * @return true if the stale bytes recorded in the cache header are at least reclaimStalePercent of the used bytes
+ */
+bool
+SH_CompositeCacheImpl::isStaleSpaceReclaimable(J9VMThread* currentThread, UDATA reclaimStalePercent)
+{
+	U_32 usedBytes = 0;
+	bool result = false;
+
+	if ((0 != reclaimStalePercent)
+		&& (0 != (usedBytes = getUsedBytes()))
+	) {
+		result = ((_theca->staleBytes * 100) >= ((UDATA)usedBytes * reclaimStalePercent));
+		Trc_SHR_CC_isStaleSpaceReclaimable_Event(currentThread, _theca->staleBytes, (UDATA)usedBytes, reclaimStalePercent, (UDATA)(result ? 1 : 0));
+	}
+	return result;
+}
+
+#define CC_RECLAIM_BLOCK_LIVE 0x1
+#define CC_RECLAIM_BLOCK_HAS_ITEM 0x2
+
+/* A ROMClass in the segment of a cache compacted by reclaimStaleSpace() */
+typedef struct CCReclaimBlock {
+	U_32 oldOffset;
+	U_32 newOffset;
+	U_32 size;
+	U_32 flags;
+} CCReclaimBlock;
+
+/* A metadata item of a cache compacted by reclaimStaleSpace() */
+typedef struct CCReclaimItem {
+	U_32 oldOffset;		/* offset of the ShcItem */
+	U_32 length;		/* length of the item including its ShcItemHdr */
+	U_32 newOffset;
+	U_32 newLength;		/* length of the item including the padding that keeps its alignment */
+	U_16 type;
+	bool stale;
+	bool keep;
+} CCReclaimItem;
+
+typedef struct CCReclaimState {
+	J9VMThread* currentThread;
+	J9SharedCacheHeader* ca;
+	U_8* image;
+	CCReclaimBlock* blocks;
+	UDATA blockCount;
+	CCReclaimItem* items;
+	UDATA itemCount;
+	UDATA* worklist;
+	UDATA worklistCount;
+	CCReclaimBlock* currentBlock;
+	UDATA debugStart;
+	bool relocate;
+	bool failed;
+} CCReclaimState;
+
+/* Find the ROMClass which holds an offset. The blocks are in ascending order of offset. */
+static CCReclaimBlock*
+reclaimFindBlock(CCReclaimState* state, UDATA offset)
+{
+	UDATA low = 0;
+	UDATA high = state->blockCount;
+
+	while (low < high) {
+		UDATA mid = low + ((high - low) / 2);
+		CCReclaimBlock* block = &state->blocks[mid];
+
+		if (offset < block->oldOffset) {
+			high = mid;
+		} else if (offset >= ((UDATA)block->oldOffset + block->size)) {
+			low = mid + 1;
+		} else {
+			return block;
+		}
+	}
+	return NULL;
+}
+
+/* Find the item which holds an offset. The items are in the order of the metadata walk, which is descending order of offset. */
+static CCReclaimItem*
+reclaimFindItem(CCReclaimState* state, UDATA offset)
+{
+	UDATA low = 0;
+	UDATA high = state->itemCount;
+
+	while (low < high) {
+		UDATA mid = low + ((high - low) / 2);
+		CCReclaimItem* item = &state->items[mid];
+
+		if (offset >= ((UDATA)item->oldOffset + item->length)) {
+			high = mid;
+		} else if (offset < item->oldOffset) {
+			low = mid + 1;
+		} else {
+			return item;
+		}
+	}
+	return NULL;
+}
+
+static void
+reclaimMarkBlockLive(CCReclaimState* state, CCReclaimBlock* block)
+{
+	if (J9_ARE_NO_BITS_SET(block->flags, CC_RECLAIM_BLOCK_LIVE)) {
+		block->flags |= CC_RECLAIM_BLOCK_LIVE;
+		state->worklist[state->worklistCount] = block - state->blocks;
+		state->worklistCount += 1;
+	}
+}
+
+/**
+ * Find the offset in the compacted cache of an address in the ROMClass segment or the debug area of the cache.
+ * An address in the ROMClass being walked may be the end of the ROMClass, as SRPs to empty sections at the
+ * end of a ROMClass point there. The debug area is not moved.
+ *
+ * @param [in] state  The compaction state
+ * @param [in] address  The address in the cache
+ * @param [in] markLive  If true, the ROMClass holding the address is made live, otherwise it must already be live
+ * @param [out] newOffset  The offset of the address in the compacted cache
+ *
+ * @return true on success, false if the address is not in a ROMClass or the debug area
+ */
+static bool
+reclaimMapAddress(CCReclaimState* state, const U_8* address, bool markLive, UDATA* newOffset)
+{
+	IDATA offset = (IDATA)(address - (U_8*)state->ca);
+	CCReclaimBlock* block = state->currentBlock;
+
+	if ((offset < (IDATA)state->ca->readWriteBytes) || (offset > (IDATA)state->ca->totalBytes)) {
+		return false;
+	}
+	if ((NULL == block) || ((UDATA)offset < block->oldOffset) || ((UDATA)offset > ((UDATA)block->oldOffset + block->size))) {
+		if ((UDATA)offset >= state->debugStart) {
+			*newOffset = (UDATA)offset;
+			return true;
+		}
+		block = reclaimFindBlock(state, (UDATA)offset);
+		if (NULL == block) {
+			return false;
+		}
+		if (markLive) {
+			reclaimMarkBlockLive(state, block);
+		} else if (J9_ARE_NO_BITS_SET(block->flags, CC_RECLAIM_BLOCK_LIVE)) {
+			return false;
+		}
+	}
+	*newOffset = block->newOffset + ((UDATA)offset - block->oldOffset);
+	return true;
+}
+
+/**
+ * Process an SRP of a live ROMClass. When finding the live ROMClasses, the ROMClass it points to is made live.
+ * When relocating, the SRP is written to the compacted cache with the new distance to its target.
+ */
+static void
+reclaimProcessSRP(CCReclaimState* state, U_8* slot, IDATA value, bool isWide)
+{
+	UDATA newSlot = 0;
+	UDATA newTarget = 0;
+
+	if (0 == value) {
+		return;
+	}
+	if (!reclaimMapAddress(state, slot + value, !state->relocate, &newTarget)
+		|| (state->relocate && !reclaimMapAddress(state, slot, false, &newSlot))
+	) {
+		Trc_SHR_CC_buildCompactedCache_UnresolvedSRP(state->currentThread, slot, value);
+		state->failed = true;
+		return;
+	}
+	if (state->relocate) {
+		if (isWide) {
+			*(J9WSRP*)(state->image + newSlot) = (J9WSRP)(newTarget - newSlot);
+		} else {
+			*(J9SRP*)(state->image + newSlot) = (J9SRP)(newTarget - newSlot);
+		}
+	}
+}
+
+static void
+reclaimSlotCallback(J9ROMClass* romClass, U_32 slotType, void* slotPtr, const char* slotName, void* userData)
+{
+	CCReclaimState* state = (CCReclaimState*)userData;
+
+	if (state->failed) {
+		return;
+	}
+	switch (slotType) {
+	case J9ROM_SRP:
+	case J9ROM_UTF8:
+		reclaimProcessSRP(state, (U_8*)slotPtr, *(J9SRP*)slotPtr, false);
+		break;
+	case J9ROM_NAS:
+	{
+		J9SRP value = *(J9SRP*)slotPtr;
+
+		reclaimProcessSRP(state, (U_8*)slotPtr, value, false);
+		if ((0 != value) && !state->failed) {
+			/* The ROMClass walker does not walk the SRPs in a NAS, which may be in another ROMClass */
+			J9ROMNameAndSignature* nas = (J9ROMNameAndSignature*)((U_8*)slotPtr + value);
+
+			reclaimProcessSRP(state, (U_8*)&nas->name, nas->name, false);
+			reclaimProcessSRP(state, (U_8*)&nas->signature, nas->signature, false);
+		}
+		break;
+	}
+	case J9ROM_WSRP:
+		reclaimProcessSRP(state, (U_8*)slotPtr, *(J9WSRP*)slotPtr, true);
+		break;
+	default:
+		break;
+	}
+}
+
+/* Find the kept item that a J9ShrOffset of the cache being compacted refers to */
+static CCReclaimItem*
+reclaimFindKeptItem(CCReclaimState* state, const J9ShrOffset* offset)
+{
+	CCReclaimItem* item = NULL;
+
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+	if (0 != offset->cacheLayer) {
+		return NULL;
+	}
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+	item = reclaimFindItem(state, offset->offset);
+	if ((NULL != item) && item->keep) {
+		return item;
+	}
+	return NULL;
+}
+
+/* Find the ROMClass that a J9ShrOffset of the cache being compacted refers to */
+static CCReclaimBlock*
+reclaimFindROMClass(CCReclaimState* state, const J9ShrOffset* offset)
+{
+	CCReclaimBlock* block = NULL;
+
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+	if (0 != offset->cacheLayer) {
+		return NULL;
+	}
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+	block = reclaimFindBlock(state, offset->offset);
+	if ((NULL != block) && (block->oldOffset == offset->offset)) {
+		return block;
+	}
+	return NULL;
+}
+
+/* Update a J9ShrOffset copied to the compacted cache to refer to the new location of its target */
+static void
+reclaimRemapOffset(CCReclaimState* state, J9ShrOffset* offset)
+{
+	UDATA oldOffset = offset->offset;
+	CCReclaimBlock* block = reclaimFindBlock(state, oldOffset);
+	CCReclaimItem* item = NULL;
+
+	if (NULL != block) {
+		if (J9_ARE_ALL_BITS_SET(block->flags, CC_RECLAIM_BLOCK_LIVE)) {
+			offset->offset = (U_32)(block->newOffset + (oldOffset - block->oldOffset));
+			return;
+		}
+	} else if ((NULL != (item = reclaimFindItem(state, oldOffset))) && item->keep) {
+		offset->offset = (U_32)(item->newOffset + (oldOffset - item->oldOffset));
+		return;
+	}
+	Trc_SHR_CC_buildCompactedCache_UnresolvedOffset(state->currentThread, oldOffset);
+	state->failed = true;
+}
+
+/**
+ * Build a compacted copy of a cache, which keeps the live classes and the metadata needed to find them.
+ *
+ * Non-stale ROMClass items, the classpaths and scopes they refer to, orphans and the ROMClasses they refer to are kept,
+ * along with the ROMClasses reachable from them through shared UTF8s and NASs. ROMClasses are moved down to close the
+ * gaps left by stale ones and their SRPs are relocated. Metadata items are moved up, keeping their alignment, and the
+ * offsets they hold are updated. The debug area is copied unchanged.
+ * AOT code, JIT data and class chains are dropped as they hold cache offsets that are only valid for the old layout.
+ * So are the ROMClass index and private byte data. The string intern table is rebuilt by the next JVM that attaches.
+ *
+ * @param [in] currentThread  The current thread, which holds the write mutex
+ * @param [in] ca  The cache to compact
+ * @param [out] classCount  The number of ROMClasses kept
+ * @param [out] reclaimedBytes  The number of bytes freed in the compacted cache
+ *
+ * @return The compacted cache, totalBytes long, to be freed by the caller, or NULL on failure
+ */
+static U_8*
+reclaimBuildCompactedCache(J9VMThread* currentThread, J9SharedCacheHeader* ca, UDATA* classCount, UDATA* reclaimedBytes)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	CCReclaimState state;
+	J9SharedCacheHeader* newca = NULL;
+	BlockPtr segmentEnd = SEGUPDATEPTR(ca);
+	BlockPtr walk = NULL;
+	ShcItemHdr* ih = NULL;
+	U_8* arrays = NULL;
+	UDATA arrayBytes = 0;
+	UDATA newSegmentSRP = ca->readWriteBytes;
+	UDATA newUpdateSRP = 0;
+	UDATA keptItems = 0;
+	UDATA i = 0;
+
+	memset(&state, 0, sizeof(CCReclaimState));
+	state.currentThread = currentThread;
+	state.ca = ca;
+	state.debugStart = (UDATA)(CADEBUGSTART(ca) - (BlockPtr)ca);
+	newUpdateSRP = state.debugStart;
+	*classCount = 0;
+	*reclaimedBytes = 0;
+
+	/* Count the ROMClasses and the metadata items */
+	for (walk = CASTART(ca); walk < segmentEnd; walk += ((J9ROMClass*)walk)->romSize) {
+		U_32 romSize = ((J9ROMClass*)walk)->romSize;
+
+		if ((0 == romSize) || (0 != (romSize % SHC_DOUBLEALIGN)) || (romSize > (UDATA)(segmentEnd - walk))) {
+			Trc_SHR_CC_buildCompactedCache_BadROMClass(currentThread, walk, romSize);
+			goto fail;
+		}
+		state.blockCount += 1;
+	}
+	for (ih = (ShcItemHdr*)CCFIRSTENTRY(ca); (BlockPtr)ih > UPDATEPTR(ca); ih = CCITEMNEXT(ih)) {
+		U_32 itemLen = CCITEMLEN(ih);
+
+		if ((itemLen < (sizeof(ShcItem) + sizeof(ShcItemHdr)))
+			|| ((UDATA)((BlockPtr)ih - UPDATEPTR(ca)) < (itemLen - sizeof(ShcItemHdr)))
+		) {
+			Trc_SHR_CC_buildCompactedCache_BadItem(currentThread, ih, itemLen);
+			goto fail;
+		}
+		state.itemCount += 1;
+	}
+
+	arrayBytes = (state.blockCount * (sizeof(CCReclaimBlock) + sizeof(UDATA))) + (state.itemCount * sizeof(CCReclaimItem));
+	arrays = (U_8*)j9mem_allocate_memory(arrayBytes, J9MEM_CATEGORY_CLASSES);
+	if (NULL == arrays) {
+		Trc_SHR_CC_buildCompactedCache_AllocFailed(currentThread, arrayBytes);
+		goto fail;
+	}
+	state.blocks = (CCReclaimBlock*)arrays;
+	state.worklist = (UDATA*)(state.blocks + state.blockCount);
+	state.items = (CCReclaimItem*)(state.worklist + state.blockCount);
+
+	i = 0;
+	for (walk = CASTART(ca); walk < segmentEnd; walk += ((J9ROMClass*)walk)->romSize) {
+		CCReclaimBlock* block = &state.blocks[i++];
+
+		block->oldOffset = (U_32)(walk - (BlockPtr)ca);
+		block->newOffset = 0;
+		block->size = ((J9ROMClass*)walk)->romSize;
+		block->flags = 0;
+	}
+	i = 0;
+	for (ih = (ShcItemHdr*)CCFIRSTENTRY(ca); (BlockPtr)ih > UPDATEPTR(ca); ih = CCITEMNEXT(ih)) {
+		CCReclaimItem* item = &state.items[i++];
+		ShcItem* it = (ShcItem*)CCITEM(ih);
+
+		item->oldOffset = (U_32)((BlockPtr)it - (BlockPtr)ca);
+		item->length = CCITEMLEN(ih);
+		item->newOffset = 0;
+		item->newLength = 0;
+		item->type = ITEMTYPE(it);
+		item->stale = (0 != CCITEMSTALE(ih));
+		item->keep = false;
+		if ((TYPE_CACHELET == item->type) || (TYPE_PREREQ_CACHE == item->type)) {
+			Trc_SHR_CC_buildCompactedCache_UnsupportedItem(currentThread, it, item->type);
+			goto fail;
+		}
+	}
+
+	/* Classpaths and scopes are kept first, as the other items refer to them */
+	for (i = 0; i < state.itemCount; i++) {
+		CCReclaimItem* item = &state.items[i];
+
+		if (!item->stale && ((TYPE_CLASSPATH == item->type) || (TYPE_SCOPE == item->type))) {
+			item->keep = true;
+		}
+	}
+
+	/* ROMClass items keep their ROMClasses live. Only the byte data which does not refer to cache offsets is kept. */
+	for (i = 0; i < state.itemCount; i++) {
+		CCReclaimItem* item = &state.items[i];
+		U_8* data = ITEMDATA((BlockPtr)ca + item->oldOffset);
+
+		if ((TYPE_ROMCLASS == item->type) || (TYPE_SCOPED_ROMCLASS == item->type)) {
+			ROMClassWrapper* rcw = (ROMClassWrapper*)data;
+			CCReclaimBlock* block = reclaimFindROMClass(&state, &rcw->romClassOffset);
+
+			if (NULL == block) {
+				if (item->stale) {
+					continue;
+				}
+				Trc_SHR_CC_buildCompactedCache_UnresolvedOffset(currentThread, (UDATA)rcw->romClassOffset.offset);
+				goto fail;
+			}
+			block->flags |= CC_RECLAIM_BLOCK_HAS_ITEM;
+			if (item->stale || (NULL == reclaimFindKeptItem(&state, &rcw->theCpOffset))) {
+				continue;
+			}
+			if (TYPE_SCOPED_ROMCLASS == item->type) {
+				ScopedROMClassWrapper* srcw = (ScopedROMClassWrapper*)data;
+
+				if (((0 != srcw->modContextOffset.offset) && (NULL == reclaimFindKeptItem(&state, &srcw->modContextOffset)))
+					|| ((0 != srcw->partitionOffset.offset) && (NULL == reclaimFindKeptItem(&state, &srcw->partitionOffset)))
+				) {
+					continue;
+				}
+			}
+			item->keep = true;
+			reclaimMarkBlockLive(&state, block);
+		} else if ((TYPE_BYTE_DATA == item->type) && !item->stale) {
+			ByteDataWrapper* bdw = (ByteDataWrapper*)data;
+			UDATA dataType = BDWTYPE(bdw);
+
+			if (((J9SHR_DATA_TYPE_JCL == dataType) || (J9SHR_DATA_TYPE_ZIPCACHE == dataType) || (J9SHR_DATA_TYPE_STARTUP_HINTS == dataType))
+				&& (0 == BDWINPRIVATEUSE(bdw))
+				&& (0 == bdw->externalBlockOffset.offset)
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+				&& (0 == bdw->externalBlockOffset.cacheLayer)
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+				&& ((0 == bdw->tokenOffset.offset) || (NULL != reclaimFindKeptItem(&state, &bdw->tokenOffset)))
+			) {
+				item->keep = true;
+			}
+		}
+	}
+
+	/* An orphan whose ROMClass has no ROMClass item is kept. If the ROMClass items are stale, the orphan only
+	 * stays if the ROMClass is reachable from a live ROMClass, so a stale class does not survive through its orphan. */
+	for (i = 0; i < state.itemCount; i++) {
+		CCReclaimItem* item = &state.items[i];
+
+		if (!item->stale && (TYPE_ORPHAN == item->type)) {
+			OrphanWrapper* ow = (OrphanWrapper*)ITEMDATA((BlockPtr)ca + item->oldOffset);
+			CCReclaimBlock* block = reclaimFindROMClass(&state, &ow->romClassOffset);
+
+			if ((NULL != block) && J9_ARE_NO_BITS_SET(block->flags, CC_RECLAIM_BLOCK_HAS_ITEM)) {
+				item->keep = true;
+				reclaimMarkBlockLive(&state, block);
+			}
+		}
+	}
+
+	/* Make the ROMClasses whose UTF8s and NASs are used by live ROMClasses live */
+	while (0 != state.worklistCount) {
+		state.worklistCount -= 1;
+		state.currentBlock = &state.blocks[state.worklist[state.worklistCount]];
+		allSlotsInROMClassDo((J9ROMClass*)((BlockPtr)ca + state.currentBlock->oldOffset), reclaimSlotCallback, NULL, NULL, &state);
+		if (state.failed) {
+			goto fail;
+		}
+	}
+	state.currentBlock = NULL;
+
+	for (i = 0; i < state.itemCount; i++) {
+		CCReclaimItem* item = &state.items[i];
+
+		if (!item->stale && !item->keep && (TYPE_ORPHAN == item->type)) {
+			OrphanWrapper* ow = (OrphanWrapper*)ITEMDATA((BlockPtr)ca + item->oldOffset);
+			CCReclaimBlock* block = reclaimFindROMClass(&state, &ow->romClassOffset);
+
+			if ((NULL != block) && J9_ARE_ALL_BITS_SET(block->flags, CC_RECLAIM_BLOCK_LIVE)) {
+				item->keep = true;
+			}
+		}
+	}
+
+	/* Lay out the compacted cache. ROMClass sizes are multiples of SHC_DOUBLEALIGN, so moving the ROMClasses keeps their
+	 * alignment. Items are padded so that they keep their alignment. Neither area can grow, so the copy always fits. */
+	for (i = 0; i < state.blockCount; i++) {
+		CCReclaimBlock* block = &state.blocks[i];
+
+		if (J9_ARE_ALL_BITS_SET(block->flags, CC_RECLAIM_BLOCK_LIVE)) {
+			block->newOffset = (U_32)newSegmentSRP;
+			newSegmentSRP += block->size;
+			*classCount += 1;
+		}
+	}
+	for (i = 0; i < state.itemCount; i++) {
+		CCReclaimItem* item = &state.items[i];
+
+		if (item->keep) {
+			UDATA newStart = newUpdateSRP - item->length;
+			UDATA padding = (newStart - item->oldOffset) % SHC_DOUBLEALIGN;
+
+			newStart -= padding;
+			item->newOffset = (U_32)newStart;
+			item->newLength = item->length + (U_32)padding;
+			newUpdateSRP = newStart;
+			keptItems += 1;
+		}
+	}
+
+	state.image = (U_8*)j9mem_allocate_memory(ca->totalBytes, J9MEM_CATEGORY_CLASSES);
+	if (NULL == state.image) {
+		Trc_SHR_CC_buildCompactedCache_AllocFailed(currentThread, (UDATA)ca->totalBytes);
+		goto fail;
+	}
+	memset(state.image, 0, ca->totalBytes);
+	memcpy(state.image, ca, sizeof(J9SharedCacheHeader));
+	memcpy(state.image + state.debugStart, (BlockPtr)ca + state.debugStart, ca->debugRegionSize);
+	for (i = 0; i < state.blockCount; i++) {
+		CCReclaimBlock* block = &state.blocks[i];
+
+		if (J9_ARE_ALL_BITS_SET(block->flags, CC_RECLAIM_BLOCK_LIVE)) {
+			memcpy(state.image + block->newOffset, (BlockPtr)ca + block->oldOffset, block->size);
+		}
+	}
+	for (i = 0; i < state.itemCount; i++) {
+		CCReclaimItem* item = &state.items[i];
+
+		if (item->keep) {
+			ShcItem* newItem = (ShcItem*)(state.image + item->newOffset);
+			ShcItemHdr* newIh = (ShcItemHdr*)(state.image + item->newOffset + item->newLength - sizeof(ShcItemHdr));
+			U_32 newLength = item->newLength;
+
+			/* The padding goes at the end of the data, which the wrappers do not read */
+			memcpy(newItem, (BlockPtr)ca + item->oldOffset, item->length - sizeof(ShcItemHdr));
+			newItem->dataLen = newLength - sizeof(ShcItemHdr);
+			CCSETITEMLEN(newIh, newLength);
+
+			switch (item->type) {
+			case TYPE_ROMCLASS:
+			case TYPE_SCOPED_ROMCLASS:
+			{
+				ROMClassWrapper* rcw = (ROMClassWrapper*)ITEMDATA(newItem);
+
+				reclaimRemapOffset(&state, &rcw->theCpOffset);
+				reclaimRemapOffset(&state, &rcw->romClassOffset);
+				if (TYPE_SCOPED_ROMCLASS == item->type) {
+					ScopedROMClassWrapper* srcw = (ScopedROMClassWrapper*)ITEMDATA(newItem);
+
+					if (0 != srcw->modContextOffset.offset) {
+						reclaimRemapOffset(&state, &srcw->modContextOffset);
+					}
+					if (0 != srcw->partitionOffset.offset) {
+						reclaimRemapOffset(&state, &srcw->partitionOffset);
+					}
+				}
+				break;
+			}
+			case TYPE_ORPHAN:
+				reclaimRemapOffset(&state, &((OrphanWrapper*)ITEMDATA(newItem))->romClassOffset);
+				break;
+			case TYPE_BYTE_DATA:
+			{
+				ByteDataWrapper* bdw = (ByteDataWrapper*)ITEMDATA(newItem);
+
+				if (0 != bdw->tokenOffset.offset) {
+					reclaimRemapOffset(&state, &bdw->tokenOffset);
+				}
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+	if (state.failed) {
+		goto fail;
+	}
+
+	/* Relocate the SRPs of the live ROMClasses, including the ones in their debug data */
+	state.relocate = true;
+	for (i = 0; i < state.blockCount; i++) {
+		state.currentBlock = &state.blocks[i];
+		if (J9_ARE_ALL_BITS_SET(state.currentBlock->flags, CC_RECLAIM_BLOCK_LIVE)) {
+			allSlotsInROMClassDo((J9ROMClass*)((BlockPtr)ca + state.currentBlock->oldOffset), reclaimSlotCallback, NULL, NULL, &state);
+			if (state.failed) {
+				goto fail;
+			}
+		}
+	}
+
+	newca = (J9SharedCacheHeader*)state.image;
+	newca->updateSRP = newUpdateSRP;
+	newca->readWriteSRP = sizeof(J9SharedCacheHeader);
+	newca->segmentSRP = newSegmentSRP;
+	newca->updateCount = keptItems;
+	newca->readerCount = 0;
+	newca->writeHash = 0;
+	newca->crashCntr = 0;
+	newca->aotBytes = 0;
+	newca->jitBytes = 0;
+	newca->corruptFlag = 0;
+	newca->locked = 0;
+	newca->sharedStringHead = 0;
+	newca->sharedStringTail = 0;
+	newca->totalSharedStringNodes = 0;
+	newca->totalSharedStringWeight = 0;
+	newca->readWriteFlags &= ~J9SHR_HEADER_STRING_TABLE_INITIALIZED;
+	newca->readWriteCrashCntr = 0;
+	newca->crcValid = 0;
+	newca->crcValue = 0;
+	newca->cacheFullFlags = 0;
+	newca->extraFlags &= ~J9SHR_EXTRA_FLAGS_AOT_HEADER_PRESENT;
+	newca->corruptionCode = NO_CORRUPTION;
+	newca->corruptValue = 0;
+	newca->lastMetadataType = 0;
+	newca->writerCount = 0;
+	newca->romClassIndexSRP = 0;
+	newca->staleBytes = 0;
+
+	*reclaimedBytes = (ca->segmentSRP - newSegmentSRP) + (newUpdateSRP - ca->updateSRP);
+	Trc_SHR_CC_buildCompactedCache_Built(currentThread, *classCount, keptItems, *reclaimedBytes);
+	j9mem_free_memory(arrays);
+	return state.image;
+
+fail:
+	if (NULL != state.image) {
+		j9mem_free_memory(state.image);
+	}
+	if (NULL != arrays) {
+		j9mem_free_memory(arrays);
+	}
+	return NULL;
+}
+
+/**
+ * Compact the cache if enough of it is held by stale data.
+ *
+ * A compacted copy of the cache, which keeps the live classes and drops stale data, see reclaimBuildCompactedCache(),
+ * replaces the cache file. JVMs attached to the cache, including this one, keep using the old cache, JVMs started
+ * later use the compacted copy. Only a persistent cache with a single layer and no cachelets can be compacted,
+ * as the unique ID of a layer, which the layers above it refer to, changes with its size.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] reclaimStalePercent  The percentage of the used space that must be held by stale data
+ * @param [in] isUtility  True for the reclaimStale= utility, false for autoReclaimStale=
+ *
+ * @return The number of bytes reclaimed, 0 if the cache has not been compacted, -1 on failure
+ */
+IDATA
+SH_CompositeCacheImpl::reclaimStaleSpace(J9VMThread* currentThread, UDATA reclaimStalePercent, bool isUtility)
+{
+	/* autoReclaimStale= is checked by every JVM that starts, so it only reports the outcome with verbose */
+	UDATA verboseLevel = isUtility ? J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT : J9SHR_VERBOSEFLAG_ENABLE_VERBOSE;
+	const char* fnName = "CC reclaimStaleSpace";
+	char nameWithVGen[J9SH_MAXPATH];
+	U_8* image = NULL;
+	UDATA classCount = 0;
+	UDATA reclaimedBytes = 0;
+	IDATA rc = -1;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	Trc_SHR_CC_reclaimStaleSpace_Entry(currentThread, reclaimStalePercent, (UDATA)(isUtility ? 1 : 0));
+	Trc_SHR_Assert_True((NULL != _theca) && (_started));
+
+	j9str_printf(PORTLIB, nameWithVGen, J9SH_MAXPATH, "%s", getCacheNameWithVGen());
+	if (_readOnlyOSCache
+		|| (NULL != _parent)
+		|| (0 != _layer)
+		|| getContainsCachelets()
+		|| J9_ARE_NO_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_PERSISTENT_CACHE)
+		|| !SH_OSCache::isTopLayerCache(currentThread->javaVM, _sharedClassConfig->ctrlDirName, nameWithVGen)
+	) {
+		CC_TRACE(verboseLevel, J9NLS_WARNING, J9NLS_SHRC_CC_RECLAIM_STALE_NOT_SUPPORTED);
+		Trc_SHR_CC_reclaimStaleSpace_NotSupported(currentThread);
+		goto done;
+	}
+
+	if (0 != enterWriteMutex(currentThread, false, fnName)) {
+		CC_TRACE(verboseLevel, J9NLS_WARNING, J9NLS_SHRC_CC_RECLAIM_STALE_FAILED);
+		Trc_SHR_CC_reclaimStaleSpace_enterWriteMutexFailed(currentThread);
+		goto done;
+	}
+
+	if (!isStaleSpaceReclaimable(currentThread, reclaimStalePercent)) {
+		CC_TRACE2(verboseLevel, J9NLS_INFO, J9NLS_SHRC_CC_RECLAIM_STALE_NOT_NEEDED, _theca->staleBytes, reclaimStalePercent);
+		rc = 0;
+		goto exitMutex;
+	}
+
+	CC_TRACE2(verboseLevel, J9NLS_INFO, J9NLS_SHRC_CC_RECLAIM_STALE_DATA, _theca->staleBytes, (_theca->staleBytes * 100) / getUsedBytes());
+	image = reclaimBuildCompactedCache(currentThread, _theca, &classCount, &reclaimedBytes);
+	if ((NULL == image) || (0 != _oscache->replaceCacheData(image, _theca->totalBytes))) {
+		CC_TRACE(verboseLevel, J9NLS_WARNING, J9NLS_SHRC_CC_RECLAIM_STALE_FAILED);
+		goto exitMutex;
+	}
+
+	/* JVMs attached to the old cache must not compact it again */
+	unprotectHeaderReadWriteArea(currentThread, false);
+	_theca->staleBytes = 0;
+	protectHeaderReadWriteArea(currentThread, false);
+
+	CC_TRACE2(verboseLevel, J9NLS_INFO, J9NLS_SHRC_CC_RECLAIM_STALE_COMPACTED, reclaimedBytes, classCount);
+	rc = (IDATA)reclaimedBytes;
+
+exitMutex:
+	exitWriteMutex(currentThread, fnName);
+	if (NULL != image) {
+		j9mem_free_memory(image);
+	}
+
+done:
+	Trc_SHR_CC_reclaimStaleSpace_Exit(currentThread, rc);
+	return rc;
+}
+
 /**
  * Test to see if a block is stale.
  * 
@@ -3733,6 +4540,7 @@ SH_CompositeCacheImpl::runExitCode(J9VMThread *currentThread)
 		IDATA lockrc = 0;
 		PORT_ACCESS_FROM_PORT(_portlib);
 		if ((lockrc = oscacheToUse->acquireWriteLock(_commonCCInfo->writeMutexID)) == 0) {
+			updateContentionStats(currentThread);
 			updateCacheCRC();
 			/* Deny updates so the CRC is not invalidated */
 			*_runtimeFlags |= J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES;
@@ -3747,6 +4555,120 @@ SH_CompositeCacheImpl::runExitCode(J9VMThread *currentThread)
 	return;
 }
 
+/**
+ * Add the lock contention seen by this JVM to the totals kept in the cache header,
+ * which are reported by printStats.
+ *
+ * @param [in] currentThread  Pointer to J9VMThread structure for the current thread
+ *
+ * @pre The caller must hold the write lock and the cache header must be unprotected
+ */
+void
+SH_CompositeCacheImpl::updateContentionStats(J9VMThread* currentThread)
+{
+	UDATA writeMutexWaitMillis = (UDATA)(_writeMutexWaitNanos / 1000000);
+
+	if ((0 == _readMutexWaitCount) && (0 == writeMutexWaitMillis) && (0 == _refreshMutexWaitCount)) {
+		return;
+	}
+	_theca->readMutexWaitCount += _readMutexWaitCount;
+	_theca->writeMutexWaitMillis += writeMutexWaitMillis;
+	_theca->refreshMutexWaitCount += _refreshMutexWaitCount;
+	Trc_SHR_CC_updateContentionStats_Event(currentThread, _readMutexWaitCount, writeMutexWaitMillis, _refreshMutexWaitCount);
+
+	/* runExitCode() may be called more than once */
+	_readMutexWaitCount = 0;
+	_writeMutexWaitNanos = 0;
+	_refreshMutexWaitCount = 0;
+}
+
+/**
+ * Record that a thread of this JVM had to wait for the refresh mutex of SH_CacheMap.
+ */
+void
+SH_CompositeCacheImpl::incRefreshMutexWaitCount(void)
+{
+	VM_AtomicSupport::add((UDATA*)&_refreshMutexWaitCount, 1);
+}
+
+/**
+ * Record that a ROMClass found by this JVM is in this layer.
+ */
+void
+SH_CompositeCacheImpl::incROMClassHitCount(void)
+{
+	VM_AtomicSupport::add((UDATA*)&_romClassHitCount, 1);
+}
+
+/**
+ * Record that AOT code found by this JVM is in this layer.
+ */
+void
+SH_CompositeCacheImpl::incCompiledMethodHitCount(void)
+{
+	VM_AtomicSupport::add((UDATA*)&_compiledMethodHitCount, 1);
+}
+
+/**
+ * Record that AOT code or JIT data for a ROMClass in this layer has been stored in a higher layer.
+ *
+ * @param [in] isCompiledMethod  true for AOT code, false for JIT data
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::incStoredAboveCount(bool isCompiledMethod)
+{
+	if (isCompiledMethod) {
+		_compiledMethodsStoredAbove += 1;
+	} else {
+		_jitDataStoredAbove += 1;
+	}
+}
+
+/**
+ * Get the number of AOT methods and JIT data items for ROMClasses in this layer that this JVM stored in a higher layer.
+ *
+ * @param [out] compiledMethodsStoredAbove  Number of AOT methods
+ * @param [out] jitDataStoredAbove  Number of JIT data items
+ */
+void
+SH_CompositeCacheImpl::getStoredAboveStats(UDATA* compiledMethodsStoredAbove, UDATA* jitDataStoredAbove) const
+{
+	*compiledMethodsStoredAbove = _compiledMethodsStoredAbove;
+	*jitDataStoredAbove = _jitDataStoredAbove;
+}
+
+/**
+ * Record the number of items read from this layer by SH_CacheMap::startup() and how long it took.
+ *
+ * @param [in] itemsRead  Number of items added to the hashtables
+ * @param [in] readMicros  Time spent reading the layer in microseconds
+ */
+void
+SH_CompositeCacheImpl::setStartupReadStats(UDATA itemsRead, U_64 readMicros)
+{
+	_startupItemsRead = itemsRead;
+	_startupReadMicros = readMicros;
+}
+
+/**
+ * Get the per-layer statistics of this JVM, which are reported on exit with -Xshareclasses:verbose.
+ *
+ * @param [out] romClassHits  Number of ROMClasses found in this layer
+ * @param [out] compiledMethodHits  Number of AOT methods found in this layer
+ * @param [out] startupItemsRead  Number of items read from this layer at startup
+ * @param [out] startupReadMicros  Time spent reading this layer at startup in microseconds
+ */
+void
+SH_CompositeCacheImpl::getLayerHitStats(UDATA* romClassHits, UDATA* compiledMethodHits, UDATA* startupItemsRead, U_64* startupReadMicros) const
+{
+	*romClassHits = _romClassHitCount;
+	*compiledMethodHits = _compiledMethodHitCount;
+	*startupItemsRead = _startupItemsRead;
+	*startupReadMicros = _startupReadMicros;
+}
+
 /**
  * Return ID of this JVM
  */
@@ -4491,6 +5413,10 @@ SH_CompositeCacheImpl::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDe
 		descriptor->minJIT = _theca->minJIT;
 		descriptor->maxJIT = _theca->maxJIT;
 		descriptor->softMaxBytes = (UDATA)((U_32)-1 == _theca->softMaxBytes ? descriptor->cacheSize : _theca->softMaxBytes);
+		/* totals of the JVMs which have exited, plus the contention seen so far by this JVM */
+		descriptor->readMutexWaitCount = _theca->readMutexWaitCount + _readMutexWaitCount;
+		descriptor->writeMutexWaitMillis = _theca->writeMutexWaitMillis + (UDATA)(_writeMutexWaitNanos / 1000000);
+		descriptor->refreshMutexWaitCount = _theca->refreshMutexWaitCount + _refreshMutexWaitCount;
 
 		if ((NULL != _debugData) && !_debugData->getJavacoreData(vm, descriptor, _theca)) {
 			return 0;
@@ -4535,6 +5461,22 @@ SH_CompositeCacheImpl::updateMetadataSegment(J9VMThread* currentThread)
 #endif
 }
 
+/**
+ * Check whether updateMetadataSegment() has nothing to do.
+ *
+ * @return true if the metadata memory segment already ends at the current metadata allocation pointer
+ */
+bool
+SH_CompositeCacheImpl::isMetadataSegmentCurrent(void)
+{
+	if ((NULL == _metadataSegmentPtr)
+		|| (NULL == (*_metadataSegmentPtr))
+	) {
+		return true;
+	}
+	return ((*_metadataSegmentPtr)->heapBase == (U_8*)getMetaAllocPtr());
+}
+
 /*
  * _readWriteAreaHeaderIsReadOnly is protected by the readWriteAreaMutex.
  * This function can only be called when this mutex is acquired.
@@ -4733,6 +5675,51 @@ SH_CompositeCacheImpl::setAOTHeaderPresent(J9VMThread *currentThread)
 	setCacheHeaderExtraFlags(currentThread, J9SHR_EXTRA_FLAGS_AOT_HEADER_PRESENT);
 }
 
+/**
+ * This function records the location of the persisted ROMClass index in the cache header.
+ * Any previous index is abandoned and remains in the cache as unused metadata.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ * @param [in] indexItem The TYPE_UNINDEXED_BYTE_DATA item holding the index
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::setROMClassIndexItem(J9VMThread *currentThread, const ShcItem *indexItem)
+{
+	Trc_SHR_Assert_True((NULL != this->_theca) && hasWriteMutex(currentThread));
+	if (true == _started) {
+		unprotectHeaderReadWriteArea(currentThread, false);
+	}
+	/* the index contents must be visible before other JVMs can find it */
+	VM_AtomicSupport::writeBarrier();
+	this->_theca->romClassIndexSRP = (UDATA)((BlockPtr)indexItem - (BlockPtr)this->_theca);
+	if (true == _started) {
+		protectHeaderReadWriteArea(currentThread, false);
+	}
+}
+
+/**
+ * This function returns the persisted ROMClass index recorded in the cache header.
+ *
+ * @return The TYPE_UNINDEXED_BYTE_DATA item holding the index, or NULL if there is no index
+ * 			or the recorded location is not a plausible index item.
+ */
+const ShcItem*
+SH_CompositeCacheImpl::getROMClassIndexItem(void)
+{
+	const ShcItem* indexItem = NULL;
+	UDATA indexOffset = this->_theca->romClassIndexSRP;
+
+	if (0 != indexOffset) {
+		indexItem = (const ShcItem*)((BlockPtr)this->_theca + indexOffset);
+		if (!isAddressInMetaDataArea(indexItem) || (TYPE_UNINDEXED_BYTE_DATA != ITEMTYPE(indexItem))) {
+			indexItem = NULL;
+		}
+	}
+	return indexItem;
+}
+
 /**
  * This function returns whether AOT Header has been added to the cache or not.
  *
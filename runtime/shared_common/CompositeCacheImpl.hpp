@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -144,7 +144,7 @@ public:
 
 	BlockPtr nextEntry(J9VMThread* currentThread, UDATA* staleItems);
 	
-	void markStale(J9VMThread* currentThread, BlockPtr block, bool isCacheLocked);
+	void markStale(J9VMThread* currentThread, BlockPtr block, bool isCacheLocked, UDATA segmentBytes = 0);
 
 	UDATA stale(BlockPtr block);
 	
@@ -247,6 +247,8 @@ public:
 	UDATA getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor* descriptor);
 
 	void updateMetadataSegment(J9VMThread* currentThread);
+
+	bool isMetadataSegmentCurrent(void);
 	
 	BOOLEAN isReadWriteAreaHeaderReadOnly();
 
@@ -348,6 +350,24 @@ public:
 
 	bool isAOTHeaderPresent(J9VMThread *currentThread);
 
+	void setROMClassIndexItem(J9VMThread *currentThread, const ShcItem *indexItem);
+
+	const ShcItem* getROMClassIndexItem(void);
+
+	void incRefreshMutexWaitCount(void);
+
+	void incROMClassHitCount(void);
+
+	void incCompiledMethodHitCount(void);
+
+	void incStoredAboveCount(bool isCompiledMethod);
+
+	void getStoredAboveStats(UDATA* compiledMethodsStoredAbove, UDATA* jitDataStoredAbove) const;
+
+	void setStartupReadStats(UDATA itemsRead, U_64 readMicros);
+
+	void getLayerHitStats(UDATA* romClassHits, UDATA* compiledMethodHits, UDATA* startupItemsRead, U_64* startupReadMicros) const;
+
 	bool isMprotectPartialPagesSet(J9VMThread *currentThread);
 
 	bool isMprotectPartialPagesOnStartupSet(J9VMThread *currentThread);
@@ -369,6 +389,8 @@ public:
 
 	I_32 tryAdjustMinMaxSizes(J9VMThread *currentThread, bool isJCLCall = false);
 
+	IDATA reclaimStaleSpace(J9VMThread* currentThread, UDATA reclaimStalePercent, bool isUtility);
+
 	void updateRuntimeFullFlags(J9VMThread* currentThread);
 	
 	void increaseUnstoredBytes(U_32 blockBytes, U_32 aotBytes, U_32 jitBytes);
@@ -398,7 +420,7 @@ public:
 private:
 	J9SharedClassConfig* _sharedClassConfig;
 	SH_OSCache* _oscache;
-	omrthread_monitor_t _utMutex, _headerProtectMutex, _runtimeFlagsProtectMutex;
+	omrthread_monitor_t _utMutex, _headerProtectMutex, _runtimeFlagsProtectMutex, _localReaderMutex;
 	J9PortLibrary* _portlib;
 
 	J9SharedCacheHeader* _theca;
@@ -473,6 +495,24 @@ private:
 	IDATA _headerProtectCntr;
 	IDATA _readWriteProtectCntr;
 	IDATA _readOnlyReaderCount;
+	/* Number of threads of this JVM holding the read mutex. The JVM is registered once in the shared
+	 * readerCount while this is non-zero, 0 <-> 1 transitions are made holding _localReaderMutex. */
+	volatile UDATA _localReaderCount;
+
+	/* Contention seen by this JVM, added to the cache header totals on exit */
+	volatile UDATA _readMutexWaitCount;
+	U_64 _writeMutexWaitNanos;
+	volatile UDATA _refreshMutexWaitCount;
+
+	/* Lookups of this JVM satisfied from this layer, and the cost of reading the layer at startup */
+	volatile UDATA _romClassHitCount;
+	volatile UDATA _compiledMethodHitCount;
+	/* AOT methods and JIT data for ROMClasses in this layer that this JVM stored in a higher layer */
+	UDATA _compiledMethodsStoredAbove;
+	UDATA _jitDataStoredAbove;
+	UDATA _startupItemsRead;
+	U_64 _startupReadMicros;
+
 	bool _incrementedRWCrashCntr;
 	
 	bool _useWriteHash;
@@ -502,6 +542,10 @@ private:
 
 	void incReaderCount(J9VMThread* currentThread);
 	void decReaderCount(J9VMThread* currentThread);
+	void incLocalReaderCount(J9VMThread* currentThread);
+	void decLocalReaderCount(J9VMThread* currentThread);
+	void updateContentionStats(J9VMThread* currentThread);
+	bool isStaleSpaceReclaimable(J9VMThread* currentThread, UDATA reclaimStalePercent);
 
 	void initialize(J9JavaVM* vm, BlockPtr memForConstructor, J9SharedClassConfig* sharedClassConfig, const char* cacheName, I_32 cacheTypeRequired, bool startupForStats, I_8 layer);
 	void initializeWithCommonInfo(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, BlockPtr memForConstructor, const char* cacheName, I_32 newPersistentCacheReqd, bool startupForStats, I_8 layer);
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -35,6 +35,10 @@
 #include "shrinit.h"
 #include "j9version.h"
 #include "shchelp.h"
+#if defined(J9UNIX) || defined(AIXPPC)
+#include <sys/mman.h>
+#include <sys/resource.h>
+#endif /* defined(J9UNIX) || defined(AIXPPC) */
 
 #include "OSCachesysv.hpp"
 #include "OSCachemmap.hpp"
@@ -361,6 +365,7 @@ SH_OSCache::commonStartup(J9JavaVM* vm, const char* ctrlDirName, UDATA cacheDirP
 	_createFlags = createFlag;
 	_runtimeFlags = runtimeFlags;
 	_isUserSpecifiedCacheDir = (J9_ARE_ALL_BITS_SET(_runtimeFlags, J9SHR_RUNTIMEFLAG_CACHEDIR_PRESENT));
+	_useHugePages = ((NULL != vm->sharedCacheAPI) && (0 != vm->sharedCacheAPI->hugePages));
 
 	/* get the cacheDirName for the first time */
 	if (!(_cacheDirName = (char*)j9mem_allocate_memory(J9SH_MAXPATH, J9MEM_CATEGORY_CLASSES))) {
@@ -455,6 +460,12 @@ SH_OSCache::dontNeedMetadata(J9VMThread* currentThread, const void* startAddress
 	return;
 }
 
+/* override if the cache is a file which can be replaced */
+IDATA
+SH_OSCache::replaceCacheData(const void* data, U_32 length) {
+	return -1;
+}
+
 /* Function that initializes class variables common to OSCache subclasses */
 void
 SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
@@ -480,6 +491,7 @@ SH_OSCache::commonInit(J9PortLibrary* portLibrary, UDATA generation, I_8 layer)
 	_runningReadOnly = false;
 	_doCheckBuildID = false;
 	_isUserSpecifiedCacheDir = false;
+	_useHugePages = false;
 }
 
 /* Function that cleans up resources common to OSCache subclasses */
@@ -1456,6 +1468,56 @@ SH_OSCache::getCacheNameAndLayerFromUnqiueID(J9JavaVM* vm, const char* uniqueID,
 	*layer = layerNo;
 }
 
+/**
+ * Ask the OS to back the mapped cache with transparent huge pages if -Xshareclasses:hugePages is specified.
+ * Whether huge pages are used depends on the backing store: shared memory and tmpfs honour the advice
+ * (with shmem_enabled set to advise or within_size), files on other filesystems usually do not.
+ * Ranges with different page protections (see -Xshareclasses:mprotect) cannot share a huge page.
+ *
+ * @param [in] address  Start of the mapping, page aligned
+ * @param [in] length  Length of the mapping in bytes
+ */
+void
+SH_OSCache::adviseHugePages(void* address, UDATA length)
+{
+#if defined(LINUX) && defined(MADV_HUGEPAGE)
+	if (_useHugePages && (NULL != address) && (0 != length)) {
+		PORT_ACCESS_FROM_PORT(_portLibrary);
+		IDATA rc = (IDATA)madvise(address, (size_t)length, MADV_HUGEPAGE);
+
+		Trc_SHR_OSC_adviseHugePages(address, length, rc);
+		if (0 != rc) {
+			OSC_WARNING_TRACE1(J9NLS_SHRC_OSCACHE_HUGE_PAGES_NOT_AVAILABLE, _cacheName);
+		}
+	}
+#endif /* defined(LINUX) && defined(MADV_HUGEPAGE) */
+}
+
+/**
+ * Get the number of page faults taken by this process so far.
+ *
+ * @param [out] minorFaults  Faults satisfied without I/O
+ * @param [out] majorFaults  Faults that required I/O
+ *
+ * @return true if the counts are available on this platform, false otherwise
+ */
+bool
+SH_OSCache::getPageFaultCounts(U_64* minorFaults, U_64* majorFaults)
+{
+#if defined(J9UNIX) || defined(AIXPPC)
+	struct rusage usage;
+
+	if (0 == getrusage(RUSAGE_SELF, &usage)) {
+		*minorFaults = (U_64)usage.ru_minflt;
+		*majorFaults = (U_64)usage.ru_majflt;
+		return true;
+	}
+#endif /* defined(J9UNIX) || defined(AIXPPC) */
+	*minorFaults = 0;
+	*majorFaults = 0;
+	return false;
+}
+
 /*
  * Return the layer number.
  */
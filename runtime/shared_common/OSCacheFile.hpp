@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2017 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -149,7 +149,6 @@ protected:
 
 	static void* getMmapHeaderFieldAddressForGen(void* header, UDATA headerGen, UDATA fieldID);
 
-private:
 	I_32 getFileMode();
 };
 
@@ -463,6 +463,73 @@ SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* startAdd
 #endif
 }
 
+/**
+ * Replace the cache file with a copy that holds new cache data.
+ *
+ * The copy is written next to the cache file, starting with the header of the cache file, and is then renamed
+ * over it. JVMs opening the cache see either the old or the new cache. JVMs attached to the cache, including
+ * this one, keep using the old file until they exit.
+ *
+ * @param [in] data  The new cache data, starting with its J9SharedCacheHeader
+ * @param [in] length  The length of the new cache data, which must not exceed the length of the cache data
+ *
+ * @return 0 on success, -1 on failure, in which case the cache file is left unchanged
+ */
+IDATA
+SH_OSCachemmap::replaceCacheData(const void* data, U_32 length)
+{
+	PORT_ACCESS_FROM_PORT(_portLibrary);
+	char tempPathName[J9SH_MAXPATH];
+	IDATA headerLength = (IDATA)((UDATA)_dataStart - (UDATA)_headerStart);
+	IDATA tailLength = (IDATA)_actualFileLength - headerLength - (IDATA)length;
+	IDATA fd = -1;
+	IDATA rc = -1;
+
+	Trc_SHR_OSC_Mmap_replaceCacheData_Entry(_cachePathName, length);
+
+	if ((NULL == _headerStart) || _runningReadOnly || (length > _dataLength) || (tailLength < 0)) {
+		Trc_SHR_OSC_Mmap_replaceCacheData_NotReplaceable(_dataLength, _actualFileLength);
+		goto done;
+	}
+
+	j9str_printf(PORTLIB, tempPathName, J9SH_MAXPATH, "%s%s", _cachePathName, J9SH_OSCACHE_MMAP_REPLACE_SUFFIX);
+	fd = j9file_open(tempPathName, EsOpenCreate | EsOpenWrite | EsOpenTruncate, getFileMode());
+	if (-1 == fd) {
+		Trc_SHR_OSC_Mmap_replaceCacheData_OpenFailed(tempPathName, j9error_last_error_number());
+		goto done;
+	}
+
+	if (J9_ARE_ALL_BITS_SET(_openMode, J9OSCACHE_OPEN_MODE_GROUPACCESS)
+		&& (1 != verifyCacheFileGroupAccess(_portLibrary, fd, NULL))
+	) {
+		Trc_SHR_OSC_Mmap_replaceCacheData_GroupAccessFailed(tempPathName);
+	} else if ((headerLength != j9file_write(fd, _headerStart, headerLength))
+		|| ((IDATA)length != j9file_write(fd, (void*)data, (IDATA)length))
+		|| ((tailLength > 0) && (tailLength != j9file_write(fd, (U_8*)_dataStart + length, tailLength)))
+		|| (0 != j9file_sync(fd))
+	) {
+		Trc_SHR_OSC_Mmap_replaceCacheData_WriteFailed(tempPathName, j9error_last_error_number());
+	} else {
+		rc = 0;
+	}
+	j9file_close(fd);
+
+	if (0 == rc) {
+		/* The rename fails on platforms which do not allow a file that is in use to be replaced */
+		if (0 != j9file_move(tempPathName, _cachePathName)) {
+			Trc_SHR_OSC_Mmap_replaceCacheData_MoveFailed(tempPathName, j9error_last_error_number());
+			rc = -1;
+		}
+	}
+	if (0 != rc) {
+		j9file_unlink(tempPathName);
+	}
+
+done:
+	Trc_SHR_OSC_Mmap_replaceCacheData_Exit(rc);
+	return rc;
+}
+
 /**
  * Destroy a persistent shared classes cache
  *
@@ -1000,6 +1067,7 @@ SH_OSCachemmap::internalAttach(bool isNewCache, UDATA generation)
 	}
 	_headerStart = _mapFileHandle->pointer;
 	Trc_SHR_OSC_Mmap_internalAttach_goodmapfile(_headerStart);
+	adviseHugePages(_headerStart, (UDATA)_actualFileLength);
 
 	if (!isNewCache) {
 		J9SRP* dataStartField;
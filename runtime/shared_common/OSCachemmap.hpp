@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2019 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -30,6 +30,7 @@
 
 #define J9SH_OSCACHE_MMAP_HEADER_LOCK_RETRY_COUNT 50
 #define J9SH_OSCACHE_MMAP_HEADER_LOCK_RETRY_SLEEP_MILLIS 2 /* 2ms chosen after measuring the maximum time we hold the header lock for */
+#define J9SH_OSCACHE_MMAP_REPLACE_SUFFIX "_replace"
 
 /**
  * A class to manage Shared Classes on Operating System level
@@ -94,6 +95,7 @@ public:
 
 	SH_CacheAccess isCacheAccessible(void) const;
 	virtual void dontNeedMetadata(J9VMThread* currentThread, const void* startAddress, size_t length);
+	virtual IDATA replaceCacheData(const void* data, U_32 length);
 
 protected:
 	virtual void * getAttachedMemory();
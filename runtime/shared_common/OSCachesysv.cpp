@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2019 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -1021,6 +1021,7 @@ SH_OSCachesysv::attach(J9VMThread *currentThread, J9PortShcVersion* expectedVers
 
 	_dataLength = SHM_CACHEDATASIZE(((OSCachesysv_header_version_current*)_headerStart)->oscHdr.size);
 	_attach_count++;
+	adviseHugePages(_headerStart, ((OSCachesysv_header_version_current*)_headerStart)->oscHdr.size);
 
 	if (_verboseFlags & J9SHR_VERBOSEFLAG_ENABLE_VERBOSE) {
 		OSC_TRACE2(J9NLS_SHRC_OSCACHE_ATTACH_SUCCESS, _cacheName, _dataLength);
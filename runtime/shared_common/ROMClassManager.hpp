@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2017 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -68,6 +68,16 @@ public:
 	virtual const J9ROMClass* findNextExisting(J9VMThread* currentThread, void * &findNextIterator, void * &firstFound, U_16 classnameLength, const char* classnameData) = 0;
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen) = 0;
+
+	virtual void attachROMClassIndex(J9VMThread* currentThread, BlockPtr cacheHeader, BlockPtr metadataEnd, const ShcItem* indexItem) = 0;
+
+	virtual UDATA getROMClassIndexBytes(J9VMThread* currentThread) = 0;
+
+	virtual bool writeROMClassIndex(J9VMThread* currentThread, BlockPtr cacheHeader, BlockPtr boundary, U_8* buffer, UDATA bufferBytes) = 0;
+
+	virtual void getNumUnloadedIndexItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems) = 0;
+
+	virtual bool isROMClassUsedByOtherItem(J9VMThread* currentThread, const J9ROMClass* romClass, const ShcItem* item) = 0;
 	
 };
 
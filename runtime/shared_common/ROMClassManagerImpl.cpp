@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -36,7 +36,15 @@
 
 SH_ROMClassManagerImpl::SH_ROMClassManagerImpl()
  : _tsm(0),
-   _linkedListImplPool(0)
+   _linkedListImplPool(0),
+   _vmFunctions(0),
+   _indexMutex(0),
+   _romClassIndex(0),
+   _romClassIndexEntries(0),
+   _romClassIndexBase(0),
+   _romClassIndexBoundary(0),
+   _romClassIndexLimit(0),
+   _unindexedItemCount(0)
 {
 }
 
@@ -91,6 +99,7 @@ SH_ROMClassManagerImpl::initialize(J9JavaVM* vm, SH_SharedCache* cache_, SH_Time
 	_cache = cache_;
 	_tsm = tsm_;
 	_portlib = vm->portLibrary;
+	_vmFunctions = vm->internalVMFunctions;
 	_htMutex = NULL;
 	_dataTypesRepresented[0] = TYPE_ROMCLASS;
 	_dataTypesRepresented[1] = TYPE_ORPHAN;
@@ -144,6 +153,25 @@ SH_ROMClassManagerImpl::localTearDownPools(J9VMThread* currentThread)
 
 	Trc_SHR_RMI_localTearDownPools_Exit(currentThread);
 }
+
+IDATA
+SH_ROMClassManagerImpl::localPostStartup(J9VMThread* currentThread)
+{
+	if (omrthread_monitor_init(&_indexMutex, 0)) {
+		Trc_SHR_RMI_localPostStartup_FailedIndexMutex(currentThread);
+		return -1;
+	}
+	return 0;
+}
+
+void
+SH_ROMClassManagerImpl::localPostCleanup(J9VMThread* currentThread)
+{
+	if (_indexMutex) {
+		omrthread_monitor_destroy(_indexMutex);
+		_indexMutex = NULL;
+	}
+}
 	
 U_32
 SH_ROMClassManagerImpl::getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes)
@@ -165,16 +193,48 @@ SH_ROMClassManagerImpl::getHashTableEntriesFromCacheSize(UDATA cacheSizeBytes)
 bool 
 SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet)
 {
-	HashLinkedListImpl* result = NULL;
-	bool orphanReunited = false;
-	J9ROMClass* romClass = NULL;
-	J9UTF8* utf8Name = NULL;
+	bool result = false;
+	const J9UTF8* utf8Name = NULL;
 
 	if (getState() != MANAGER_STATE_STARTED) {
 		return false;
 	}
 	Trc_SHR_RMI_storeNew_Entry(currentThread, itemInCache);
 
+	utf8Name = getItemClassName(_cache, itemInCache);
+
+	if (NULL == _romClassIndex) {
+		_unindexedItemCount += 1;
+		result = storeNewHelper(currentThread, itemInCache, cachelet);
+	} else if (((BlockPtr)itemInCache >= _romClassIndexBoundary) && ((BlockPtr)itemInCache < _romClassIndexLimit)) {
+		/* The item is loaded from the index when its class name is first looked up */
+		Trc_SHR_RMI_storeNew_CoveredByIndex(currentThread, J9UTF8_LENGTH(utf8Name), J9UTF8_DATA(utf8Name), itemInCache);
+		result = true;
+	} else if (_cache->enterLocalMutex(currentThread, _indexMutex, "indexMutex", "storeNew") == 0) {
+		_unindexedItemCount += 1;
+		/* The indexed items of the name must be in the table before a newer item is added to it */
+		if (loadFromROMClassIndexHelper(currentThread, (const char*)J9UTF8_DATA(utf8Name), J9UTF8_LENGTH(utf8Name))) {
+			result = storeNewHelper(currentThread, itemInCache, cachelet);
+		}
+		_cache->exitLocalMutex(currentThread, _indexMutex, "indexMutex", "storeNew");
+	}
+
+	if (result) {
+		Trc_SHR_RMI_storeNew_ExitTrue(currentThread);
+	} else {
+		Trc_SHR_RMI_storeNew_ExitFalse(currentThread);
+	}
+	return result;
+}
+
+/* Adds an item to the hashtable, reuniting it with its orphan if there is one */
+bool
+SH_ROMClassManagerImpl::storeNewHelper(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet)
+{
+	bool orphanReunited = false;
+	J9ROMClass* romClass = NULL;
+	J9UTF8* utf8Name = NULL;
+
 	if (ITEMTYPE(itemInCache) == TYPE_ORPHAN) {
 		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(itemInCache))->romClassOffset));
 	} else {
@@ -193,16 +253,27 @@ SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemI
 		orphanReunited = reuniteOrphan(currentThread, (const char*)J9UTF8_DATA(utf8Name), J9UTF8_LENGTH(utf8Name), itemInCache, romClass);
 	}
 	if (!orphanReunited) {
-		result = hllTableUpdate(currentThread, _linkedListImplPool, utf8Name, itemInCache, cachelet);
-		if (!result) {
-			Trc_SHR_RMI_storeNew_ExitFalse(currentThread);
+		if (!hllTableUpdate(currentThread, _linkedListImplPool, utf8Name, itemInCache, cachelet)) {
 			return false;
 		}
 	}
-	Trc_SHR_RMI_storeNew_ExitTrue(currentThread);
  	return true;
 }
 
+/* Returns the name of the ROMClass referenced by a ROMClass, orphan or scoped ROMClass item */
+const J9UTF8*
+SH_ROMClassManagerImpl::getItemClassName(SH_SharedCache* cache, const ShcItem* item)
+{
+	J9ROMClass* romClass = NULL;
+
+	if (ITEMTYPE(item) == TYPE_ORPHAN) {
+		romClass = (J9ROMClass*)cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(item))->romClassOffset));
+	} else {
+		romClass = (J9ROMClass*)cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(item))->romClassOffset));
+	}
+	return J9ROMCLASS_CLASSNAME(romClass);
+}
+
 /* When an orphan is encountered in the cache, this is added to the hashtable with isOrphan==true. 
  * If a ROMClass entry is found which points to the same ROMClass as the orphan,
  * the hashtable entry should be re-used: The fact that we have an orphan is no longer relevant.
@@ -276,6 +347,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 
 	if (findNextIterator == NULL) {
 		Trc_SHR_RMI_findNextROMClass_FirstElem_Event(currentThread);
+		loadFromROMClassIndex(currentThread, classnameData, classnameLength);
 		walk = hllTableLookup(currentThread, classnameData, classnameLength, true);
 		firstFound = (void *)walk;
 		findNextIterator = (void *)walk;
@@ -338,6 +410,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 UDATA
 SH_ROMClassManagerImpl::existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen)
 {
+	loadFromROMClassIndex(currentThread, path, (U_16)pathLen);
 	return (hllTableLookup(currentThread, path, (U_16)pathLen, true) != NULL);	
 }
 
@@ -399,6 +472,7 @@ SH_ROMClassManagerImpl::locateROMClass(J9VMThread* currentThread, const char* pa
 	result->foundAtIndex = -1;
 	result->staleCPEI = NULL;
 
+	loadFromROMClassIndex(currentThread, path, pathLen);
 	found = hllTableLookup(currentThread, path, (U_16)pathLen, true);
 
 	if (!found) {
@@ -604,6 +678,420 @@ SH_ROMClassManagerImpl::checkTimestamp(J9VMThread* currentThread, const char* pa
 	return false;
 }
 
+U_32
+SH_ROMClassManagerImpl::getROMClassIndexHash(const U_8* name, U_16 nameLen)
+{
+	return (U_32)_vmFunctions->computeHashForUTF8(name, nameLen);
+}
+
+/**
+ * Starts using the persisted ROMClass index of the cache.
+ * Must be called before the cache is read, items covered by the index are not added to the hashtable when they are read.
+ * An index which fails validation is ignored.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cacheHeader The header of the cache, the offsets in the index are relative to it
+ * @param[in] metadataEnd The end of the cache metadata area
+ * @param[in] indexItem The TYPE_UNINDEXED_BYTE_DATA item holding the index
+ */
+void
+SH_ROMClassManagerImpl::attachROMClassIndex(J9VMThread* currentThread, BlockPtr cacheHeader, BlockPtr metadataEnd, const ShcItem* indexItem)
+{
+	const ROMClassIndexHeader* index = (const ROMClassIndexHeader*)ITEMDATA(indexItem);
+	UDATA indexBytes = ITEMDATALEN(indexItem);
+	BlockPtr boundary = NULL;
+
+	if ((indexBytes < sizeof(ROMClassIndexHeader))
+		|| (J9SHR_ROMCLASS_INDEX_MAGIC != index->magic)
+		|| (J9SHR_ROMCLASS_INDEX_VERSION != index->version)
+		|| (0 == index->tableSize)
+		|| (0 != (index->tableSize & (index->tableSize - 1)))
+		|| (index->entryCount >= index->tableSize)
+		|| (((indexBytes - sizeof(ROMClassIndexHeader)) / sizeof(ROMClassIndexEntry)) < index->tableSize)
+	) {
+		Trc_SHR_RMI_attachROMClassIndex_Invalid(currentThread, indexItem);
+		return;
+	}
+
+	/* The index is stored below the items it covers */
+	boundary = cacheHeader + index->boundaryOffset;
+	if ((boundary <= (BlockPtr)indexItem) || (boundary > metadataEnd)) {
+		Trc_SHR_RMI_attachROMClassIndex_Invalid(currentThread, indexItem);
+		return;
+	}
+
+	_romClassIndexEntries = (const ROMClassIndexEntry*)(index + 1);
+	_romClassIndexBase = cacheHeader;
+	_romClassIndexBoundary = boundary;
+	_romClassIndexLimit = metadataEnd;
+	_romClassIndex = index;
+
+	Trc_SHR_RMI_attachROMClassIndex_Attached(currentThread, index, index->entryCount, boundary);
+}
+
+/**
+ * Adds all the items of the persisted index for a class name to the hashtable, unless the name is already in the hashtable.
+ *
+ * THREADING: Can be called multi-threaded. A thread looking up a name while another thread loads it
+ * may see a partial list of items, which has the same effect as an item not having been read from the cache yet.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] name The class name
+ * @param[in] nameLen The length of name
+ *
+ * @return false if the hashtable could not be updated, true otherwise
+ */
+bool
+SH_ROMClassManagerImpl::loadFromROMClassIndex(J9VMThread* currentThread, const char* name, U_16 nameLen)
+{
+	bool result = false;
+
+	if ((NULL == _romClassIndex) || (NULL != hllTableLookup(currentThread, name, nameLen, true))) {
+		return true;
+	}
+
+	if (_cache->enterLocalMutex(currentThread, _indexMutex, "indexMutex", "loadFromROMClassIndex") == 0) {
+		result = loadFromROMClassIndexHelper(currentThread, name, nameLen);
+		_cache->exitLocalMutex(currentThread, _indexMutex, "indexMutex", "loadFromROMClassIndex");
+	}
+	return result;
+}
+
+/* THREADING: Must be called with _indexMutex held */
+bool
+SH_ROMClassManagerImpl::loadFromROMClassIndexHelper(J9VMThread* currentThread, const char* name, U_16 nameLen)
+{
+	U_32 hash = 0;
+	U_32 mask = 0;
+	U_32 slot = 0;
+	UDATA itemsLoaded = 0;
+
+	/* Another thread may have loaded the name */
+	if ((NULL == _romClassIndex) || (NULL != hllTableLookup(currentThread, name, nameLen, true))) {
+		return true;
+	}
+
+	hash = getROMClassIndexHash((const U_8*)name, nameLen);
+	mask = _romClassIndex->tableSize - 1;
+	slot = hash & mask;
+
+	for (U_32 probes = 0; probes < _romClassIndex->tableSize; probes++) {
+		const ROMClassIndexEntry* entry = &_romClassIndexEntries[slot];
+
+		if (0 == entry->itemOffset) {
+			break;
+		}
+		if (hash == entry->hash) {
+			const ShcItem* item = (const ShcItem*)(_romClassIndexBase + entry->itemOffset);
+
+			if (!isValidROMClassIndexItem(item)) {
+				Trc_SHR_RMI_loadFromROMClassIndex_BadEntry(currentThread, slot, item);
+			} else {
+				const J9UTF8* itemName = getItemClassName(_cache, item);
+
+				if (J9UTF8_DATA_EQUALS(J9UTF8_DATA(itemName), J9UTF8_LENGTH(itemName), name, nameLen)) {
+					if (!storeNewHelper(currentThread, item, _cache->getCompositeCacheAPI())) {
+						return false;
+					}
+					itemsLoaded += 1;
+				}
+			}
+		}
+		slot = (slot + 1) & mask;
+	}
+
+	Trc_SHR_RMI_loadFromROMClassIndex_Loaded(currentThread, itemsLoaded, nameLen, name);
+	return true;
+}
+
+/* An index entry must refer to a ROMClass, orphan or scoped ROMClass item in the metadata it covers */
+bool
+SH_ROMClassManagerImpl::isValidROMClassIndexItem(const ShcItem* item)
+{
+	UDATA itemType = 0;
+
+	if (((BlockPtr)item < _romClassIndexBoundary) || ((BlockPtr)item >= _romClassIndexLimit)) {
+		return false;
+	}
+	itemType = ITEMTYPE(item);
+	return ((TYPE_ROMCLASS == itemType) || (TYPE_ORPHAN == itemType) || (TYPE_SCOPED_ROMCLASS == itemType));
+}
+
+/**
+ * Adds all the items of the persisted index to the hashtable, for callers which need the hashtable to be complete.
+ *
+ * @param[in] currentThread The current thread
+ */
+void
+SH_ROMClassManagerImpl::loadAllFromROMClassIndex(J9VMThread* currentThread)
+{
+	if ((getState() != MANAGER_STATE_STARTED) || (NULL == _romClassIndex)) {
+		return;
+	}
+
+	if (_cache->enterLocalMutex(currentThread, _indexMutex, "indexMutex", "loadAllFromROMClassIndex") == 0) {
+		for (U_32 slot = 0; slot < _romClassIndex->tableSize; slot++) {
+			const ROMClassIndexEntry* entry = &_romClassIndexEntries[slot];
+
+			if (0 != entry->itemOffset) {
+				const ShcItem* item = (const ShcItem*)(_romClassIndexBase + entry->itemOffset);
+
+				if (isValidROMClassIndexItem(item)) {
+					const J9UTF8* itemName = getItemClassName(_cache, item);
+
+					if (!loadFromROMClassIndexHelper(currentThread, (const char*)J9UTF8_DATA(itemName), J9UTF8_LENGTH(itemName))) {
+						break;
+					}
+				}
+			}
+		}
+		_cache->exitLocalMutex(currentThread, _indexMutex, "indexMutex", "loadAllFromROMClassIndex");
+	}
+}
+
+/**
+ * Counts the items of the persisted index whose class names have not been loaded into the hashtable yet.
+ * Orphans which share a ROMClass with a ROMClass item are counted separately, so the count may be slightly high.
+ *
+ * THREADING: Only obtains the hashtable lock, so it can be used while collecting javacore data.
+ *
+ * @param[in] currentThread The current thread or NULL
+ * @param[out] nonStaleItems The number of items which are not stale
+ * @param[out] staleItems The number of stale items
+ */
+void
+SH_ROMClassManagerImpl::getNumUnloadedIndexItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems)
+{
+	*nonStaleItems = 0;
+	*staleItems = 0;
+
+	if ((getState() != MANAGER_STATE_STARTED) || (NULL == _romClassIndex)) {
+		return;
+	}
+
+	for (U_32 slot = 0; slot < _romClassIndex->tableSize; slot++) {
+		const ROMClassIndexEntry* entry = &_romClassIndexEntries[slot];
+
+		if (0 != entry->itemOffset) {
+			const ShcItem* item = (const ShcItem*)(_romClassIndexBase + entry->itemOffset);
+
+			if (isValidROMClassIndexItem(item)) {
+				const J9UTF8* itemName = getItemClassName(_cache, item);
+
+				if (NULL == hllTableLookup(currentThread, (const char*)J9UTF8_DATA(itemName), J9UTF8_LENGTH(itemName), true)) {
+					if (_cache->isStale(item)) {
+						*staleItems += 1;
+					} else {
+						*nonStaleItems += 1;
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Checks whether a ROMClass is still used by a ROMClass item other than the one given.
+ * Both the hashtable and the part of the persisted index not loaded into it yet are searched,
+ * as every ROMClass or scoped ROMClass item which uses the ROMClass is filed under its class name.
+ * Orphans are ignored, as they do not prevent the ROMClass from becoming stale.
+ *
+ * THREADING: Only obtains the hashtable lock, so it can be used with the cache write mutex held.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] romClass The ROMClass
+ * @param[in] item The item which is not counted, or NULL
+ *
+ * @return true if another non-stale ROMClass item refers to romClass, false otherwise
+ */
+bool
+SH_ROMClassManagerImpl::isROMClassUsedByOtherItem(J9VMThread* currentThread, const J9ROMClass* romClass, const ShcItem* item)
+{
+	const J9UTF8* romClassName = NULL;
+	HashLinkedListImpl* found = NULL;
+
+	if (getState() != MANAGER_STATE_STARTED) {
+		return false;
+	}
+
+	romClassName = J9ROMCLASS_CLASSNAME(romClass);
+	found = hllTableLookup(currentThread, (const char*)J9UTF8_DATA(romClassName), J9UTF8_LENGTH(romClassName), true);
+	if (NULL != found) {
+		HashLinkedListImpl* walk = found;
+
+		do {
+			if (isLiveReferenceToROMClass(walk->_item, romClass, item)) {
+				return true;
+			}
+			walk = (HashLinkedListImpl*)walk->_next;
+		} while (found != walk);
+	} else if (NULL != _romClassIndex) {
+		U_32 hash = getROMClassIndexHash(J9UTF8_DATA(romClassName), J9UTF8_LENGTH(romClassName));
+		U_32 mask = _romClassIndex->tableSize - 1;
+		U_32 slot = hash & mask;
+
+		for (U_32 probes = 0; probes < _romClassIndex->tableSize; probes++) {
+			const ROMClassIndexEntry* entry = &_romClassIndexEntries[slot];
+
+			if (0 == entry->itemOffset) {
+				break;
+			}
+			if (hash == entry->hash) {
+				const ShcItem* indexItem = (const ShcItem*)(_romClassIndexBase + entry->itemOffset);
+
+				if (isValidROMClassIndexItem(indexItem) && isLiveReferenceToROMClass(indexItem, romClass, item)) {
+					return true;
+				}
+			}
+			slot = (slot + 1) & mask;
+		}
+	}
+	return false;
+}
+
+/* Returns true if candidate is a non-stale ROMClass or scoped ROMClass item, other than item, which refers to romClass */
+bool
+SH_ROMClassManagerImpl::isLiveReferenceToROMClass(const ShcItem* candidate, const J9ROMClass* romClass, const ShcItem* item)
+{
+	UDATA itemType = ITEMTYPE(candidate);
+
+	if ((candidate == item) || ((TYPE_ROMCLASS != itemType) && (TYPE_SCOPED_ROMCLASS != itemType))) {
+		return false;
+	}
+	if (romClass != (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(candidate))->romClassOffset))) {
+		return false;
+	}
+	return !_cache->isStale(candidate);
+}
+
+/**
+ * Returns the size of the index to build for the items in the hashtable,
+ * or 0 if too few items had to be read from the cache for a new index to be worthwhile.
+ * Loads the whole of the current index, if there is one, into the hashtable.
+ *
+ * @param[in] currentThread The current thread
+ *
+ * @return the number of bytes needed for the index, or 0
+ */
+UDATA
+SH_ROMClassManagerImpl::getROMClassIndexBytes(J9VMThread* currentThread)
+{
+	UDATA indexedItems = (NULL == _romClassIndex) ? 0 : _romClassIndex->entryCount;
+	UDATA nonStaleItems = 0;
+	UDATA staleItems = 0;
+	UDATA tableSize = 1;
+
+	/* Rebuilding once as many items are not covered as are covered keeps the space used by old indexes in proportion */
+	if ((getState() != MANAGER_STATE_STARTED)
+		|| (_unindexedItemCount < J9SHR_ROMCLASS_INDEX_MIN_ITEMS)
+		|| (_unindexedItemCount < indexedItems)
+	) {
+		return 0;
+	}
+
+	loadAllFromROMClassIndex(currentThread);
+	getNumItems(currentThread, &nonStaleItems, &staleItems);
+
+	/* Keep the table at most half full so probe sequences stay short */
+	while (tableSize < ((nonStaleItems + staleItems) * 2)) {
+		tableSize <<= 1;
+	}
+	if (tableSize > (UDATA)((U_32)-1)) {
+		return 0;
+	}
+	return sizeof(ROMClassIndexHeader) + (tableSize * sizeof(ROMClassIndexEntry));
+}
+
+typedef struct ROMClassIndexWriteState {
+	SH_SharedCache* cache;
+	ROMClassIndexHeader* index;
+	ROMClassIndexEntry* entries;
+	SH_ROMClassManagerImpl::BlockPtr cacheHeader;
+	SH_ROMClassManagerImpl::BlockPtr boundary;
+	J9InternalVMFunctions* vmFunctions;
+	bool overflow;
+} ROMClassIndexWriteState;
+
+/* hashTableForEachDo function adding the items of a list to the index, in list order */
+UDATA
+SH_ROMClassManagerImpl::writeROMClassIndexEntries(void* entry, void* userData)
+{
+	HashLinkedListImpl* node = *(HashLinkedListImpl**)entry;
+	HashLinkedListImpl* walk = node;
+	ROMClassIndexWriteState* state = (ROMClassIndexWriteState*)userData;
+	U_32 mask = state->index->tableSize - 1;
+
+	do {
+		const ShcItem* item = walk->_item;
+
+		if (((BlockPtr)item >= state->boundary) && !state->overflow) {
+			const J9UTF8* itemName = getItemClassName(state->cache, item);
+			U_32 hash = (U_32)state->vmFunctions->computeHashForUTF8(J9UTF8_DATA(itemName), J9UTF8_LENGTH(itemName));
+			U_32 slot = hash & mask;
+
+			/* Leave at least one empty entry so lookups terminate */
+			if ((state->index->entryCount + 1) >= state->index->tableSize) {
+				state->overflow = true;
+				break;
+			}
+			while (0 != state->entries[slot].itemOffset) {
+				slot = (slot + 1) & mask;
+			}
+			state->entries[slot].hash = hash;
+			state->entries[slot].itemOffset = (U_32)((BlockPtr)item - state->cacheHeader);
+			state->index->entryCount += 1;
+		}
+		walk = (HashLinkedListImpl*)walk->_next;
+	} while (node != walk);
+	return 0;
+}
+
+/**
+ * Writes an index of the items in the hashtable.
+ * Must be called with the cache write mutex held after getROMClassIndexBytes(), once the hashtable is up to date with the cache.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] cacheHeader The header of the cache, the offsets in the index are relative to it
+ * @param[in] boundary The lowest address of the metadata covered by the index
+ * @param[in] buffer The buffer receiving the index
+ * @param[in] bufferBytes The size of buffer, as returned by getROMClassIndexBytes()
+ *
+ * @return true if the index was written, false otherwise
+ */
+bool
+SH_ROMClassManagerImpl::writeROMClassIndex(J9VMThread* currentThread, BlockPtr cacheHeader, BlockPtr boundary, U_8* buffer, UDATA bufferBytes)
+{
+	ROMClassIndexWriteState state;
+
+	if ((getState() != MANAGER_STATE_STARTED) || (bufferBytes < sizeof(ROMClassIndexHeader))) {
+		return false;
+	}
+
+	memset(buffer, 0, bufferBytes);
+	state.cache = _cache;
+	state.index = (ROMClassIndexHeader*)buffer;
+	state.entries = (ROMClassIndexEntry*)(state.index + 1);
+	state.cacheHeader = cacheHeader;
+	state.boundary = boundary;
+	state.vmFunctions = _vmFunctions;
+	state.overflow = false;
+
+	state.index->magic = J9SHR_ROMCLASS_INDEX_MAGIC;
+	state.index->version = J9SHR_ROMCLASS_INDEX_VERSION;
+	state.index->tableSize = (U_32)((bufferBytes - sizeof(ROMClassIndexHeader)) / sizeof(ROMClassIndexEntry));
+	state.index->entryCount = 0;
+	state.index->boundaryOffset = (U_32)(boundary - cacheHeader);
+
+	if (lockHashTable(currentThread, "writeROMClassIndex")) {
+		hashTableForEachDo(_hashTable, SH_ROMClassManagerImpl::writeROMClassIndexEntries, &state);
+		unlockHashTable(currentThread, "writeROMClassIndex");
+	} else {
+		return false;
+	}
+
+	return !state.overflow;
+}
+
 UDATA
 SH_ROMClassManagerImpl::customCountItemsInList(void* entry, void* opaque)
 {
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -34,6 +34,34 @@
 #include "j9.h"
 #include "j9protos.h"
 
+#define J9SHR_ROMCLASS_INDEX_MAGIC 0x58494352 /* "RCIX" */
+#define J9SHR_ROMCLASS_INDEX_VERSION 1
+
+/* An index is only worth building at shutdown once this many ROMClass items have to be read at startup */
+#define J9SHR_ROMCLASS_INDEX_MIN_ITEMS 1000
+
+/**
+ * Header of the persisted ROMClass index.
+ *
+ * The index is stored in the cache as unindexed byte data and is found through J9SharedCacheHeader.romClassIndexSRP.
+ * It is followed by an open addressed table of tableSize ROMClassIndexEntry, probed linearly from (hash & (tableSize - 1)).
+ * Entries with the same hash were added in cache order, so the probe sequence visits them in cache order.
+ * Every ROMClass, orphan and scoped ROMClass item at or above the boundary has an entry.
+ */
+typedef struct ROMClassIndexHeader {
+	U_32 magic;
+	U_32 version;
+	U_32 tableSize; /* number of entries in the table, a power of two */
+	U_32 entryCount; /* number of entries in use */
+	U_32 boundaryOffset; /* offset from the cache header of the lowest metadata address covered by the index */
+	U_32 reserved;
+} ROMClassIndexHeader;
+
+typedef struct ROMClassIndexEntry {
+	U_32 hash; /* hash of the class name */
+	U_32 itemOffset; /* offset of the ShcItem from the cache header, 0 for an empty entry */
+} ROMClassIndexEntry;
+
 /**
  * Implementation of SH_ROMClassManager
  *
@@ -45,6 +73,11 @@
  * 
  * Multiple class names may have the same hint value.
  * 
+ * If the cache holds a persisted ROMClass index, the items it covers are not added to the HLL table when
+ * the cache is read. Instead, all the items for a class name are loaded from the index the first time the
+ * name is looked up (or a new item with that name is found), so a name is either absent from the HLL table
+ * or present with all of its items.
+ * 
  * @ingroup Shared_Common
  */
 class SH_ROMClassManagerImpl : public SH_ROMClassManager
@@ -67,14 +100,24 @@ public:
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen);
 
+	virtual void attachROMClassIndex(J9VMThread* currentThread, BlockPtr cacheHeader, BlockPtr metadataEnd, const ShcItem* indexItem);
+
+	virtual UDATA getROMClassIndexBytes(J9VMThread* currentThread);
+
+	virtual bool writeROMClassIndex(J9VMThread* currentThread, BlockPtr cacheHeader, BlockPtr boundary, U_8* buffer, UDATA bufferBytes);
+
+	virtual void getNumUnloadedIndexItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems);
+
+	virtual bool isROMClassUsedByOtherItem(J9VMThread* currentThread, const J9ROMClass* romClass, const ShcItem* item);
+
 	void runExitCode(void) {};	
 
 protected:
 	void *operator new(size_t size, void *memoryPtr) { return memoryPtr; };
 
-	IDATA localPostStartup(J9VMThread* currentThread) { return 0; };
+	IDATA localPostStartup(J9VMThread* currentThread);
 
-	void localPostCleanup(J9VMThread* currentThread) {};
+	void localPostCleanup(J9VMThread* currentThread);
 
 	virtual J9HashTable* localHashTableCreate(J9VMThread* currentThread, U_32 initialEntries);
 
@@ -105,6 +148,38 @@ private:
 	 */
 	J9Pool* _linkedListImplPool;
 
+	J9InternalVMFunctions* _vmFunctions;
+
+	/* Serializes loading names from the persisted index with adding new items to the HLL table */
+	omrthread_monitor_t _indexMutex;
+
+	const ROMClassIndexHeader* _romClassIndex;
+	const ROMClassIndexEntry* _romClassIndexEntries;
+	BlockPtr _romClassIndexBase; /* cache header, the offsets in the index are relative to it */
+	BlockPtr _romClassIndexBoundary; /* items at or above this address are covered by the index */
+	BlockPtr _romClassIndexLimit; /* end of the metadata area */
+
+	/* Number of ROMClass items read from the cache which are not covered by the index */
+	UDATA _unindexedItemCount;
+
+	bool storeNewHelper(J9VMThread* currentThread, const ShcItem* itemInCache, SH_CompositeCache* cachelet);
+
+	bool loadFromROMClassIndex(J9VMThread* currentThread, const char* name, U_16 nameLen);
+
+	bool loadFromROMClassIndexHelper(J9VMThread* currentThread, const char* name, U_16 nameLen);
+
+	bool isValidROMClassIndexItem(const ShcItem* item);
+
+	bool isLiveReferenceToROMClass(const ShcItem* candidate, const J9ROMClass* romClass, const ShcItem* item);
+
+	void loadAllFromROMClassIndex(J9VMThread* currentThread);
+
+	U_32 getROMClassIndexHash(const U_8* name, U_16 nameLen);
+
+	static const J9UTF8* getItemClassName(SH_SharedCache* cache, const ShcItem* item);
+
+	static UDATA writeROMClassIndexEntries(void* entry, void* userData);
+
 
 	bool checkTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, ROMClassWrapper* wrapper, const ShcItem* item);
 
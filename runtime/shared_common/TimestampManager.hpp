@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2017 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -73,6 +73,21 @@ public:
 	 * 					(Contains the current timestamp)
 	 */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper) = 0;
+
+	/*
+	 * Gets the number of timestamp checks of classpath entries which went to the filesystem,
+	 * and the number which were answered from previously validated timestamps.
+	 *
+	 * Parameters:
+	 *   fileChecks		Number of file timestamps read
+	 *   fileChecksAvoided	Number of checks satisfied without reading the file timestamp
+	 */
+	virtual void getStatistics(UDATA* fileChecks, UDATA* fileChecksAvoided) = 0;
+
+	/*
+	 * Frees the resources used to remember validated timestamps.
+	 */
+	virtual void cleanup(J9VMThread* currentThread) = 0;
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2014 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -24,6 +24,13 @@
 #include "CacheMap.hpp"
 #include "ut_j9shr.h"
 #include <string.h>
+#if defined(LINUX)
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif /* defined(LINUX) */
+
+#define VALIDATED_TIMESTAMP_EXPIRED -1
+#define VALIDATED_TIMESTAMPS_INITIAL_SIZE 64
 
 SH_TimestampManagerImpl*
 SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memForConstructor, J9SharedClassConfig* sharedClassConfig)
@@ -32,6 +39,26 @@ SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memF
 
 	new(newTSM) SH_TimestampManagerImpl();
 	newTSM->_sharedClassConfig = sharedClassConfig;
+	newTSM->_portlib = vm->portLibrary;
+	newTSM->_validatedTimestampsMutex = NULL;
+	newTSM->_validatedTimestamps = NULL;
+	newTSM->_revalidateIntervalMillis = 0;
+	newTSM->_watchFD = -1;
+	newTSM->_fileChecks = 0;
+	newTSM->_fileChecksAvoided = 0;
+
+	if ((NULL != vm->sharedCacheAPI)
+		&& ((0 != vm->sharedCacheAPI->timestampCheckInterval) || (0 != vm->sharedCacheAPI->timestampWatch))
+		&& (0 == omrthread_monitor_init(&newTSM->_validatedTimestampsMutex, 0))
+	) {
+		newTSM->_revalidateIntervalMillis = vm->sharedCacheAPI->timestampCheckInterval;
+#if defined(LINUX)
+		if (0 != vm->sharedCacheAPI->timestampWatch) {
+			newTSM->_watchFD = (IDATA)inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			Trc_SHR_TMI_newInstance_Watch(newTSM->_watchFD);
+		}
+#endif /* defined(LINUX) */
+	}
 
 	return newTSM;
 }
@@ -85,7 +112,7 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	if (!pathBufPtr) {
 		return TIMESTAMP_DOES_NOT_EXIST;
 	}
-	current = j9file_lastmod(pathBufPtr);
+	current = getLastModified(currentThread, pathBufPtr, (NULL == className));
 	if (doFreeBuffer) {
 		j9mem_free_memory(pathBufPtr);
 	}
@@ -105,3 +132,257 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 }
 
 
+
+/**
+ * Get the last modified time of a file, using a previously validated timestamp of a JAR or jimage if it can still be trusted.
+ *
+ * The timestamps of class files in directories are always read, as each of them is usually checked only once.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] path The path of the file
+ * @param[in] isContainer True if path is a JAR or jimage
+ *
+ * @return The last modified time, or -1 if the file does not exist
+ */
+I_64
+SH_TimestampManagerImpl::getLastModified(J9VMThread* currentThread, const char* path, bool isContainer)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+	UDATA pathLen = strlen(path);
+	I_64 lastModified = -1;
+
+	if (!isContainer || (NULL == _validatedTimestampsMutex)) {
+		return j9file_lastmod(path);
+	}
+
+	if (findValidatedTimestamp(currentThread, path, pathLen, &lastModified)) {
+		return lastModified;
+	}
+
+	lastModified = j9file_lastmod(path);
+	if (-1 != lastModified) {
+		lastModified = storeValidatedTimestamp(currentThread, path, pathLen, lastModified);
+	}
+	return lastModified;
+}
+
+/**
+ * Look for a timestamp of path which can still be trusted: either the file is watched
+ * and no change has been reported since it was read, or it was read within the revalidation interval.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] path The path of the file
+ * @param[in] pathLen The length of path
+ * @param[out] lastModified The validated timestamp
+ *
+ * @return true if a validated timestamp was found, false if the file timestamp has to be read
+ */
+bool
+SH_TimestampManagerImpl::findValidatedTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, I_64* lastModified)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+	ValidatedTimestamp key;
+	ValidatedTimestamp* entry = NULL;
+	bool found = false;
+
+	key.path = (char*)path;
+	key.pathLen = pathLen;
+
+	omrthread_monitor_enter(_validatedTimestampsMutex);
+	processWatchEvents();
+	if (NULL != _validatedTimestamps) {
+		entry = (ValidatedTimestamp*)hashTableFind(_validatedTimestamps, &key);
+	}
+	if ((NULL != entry) && (VALIDATED_TIMESTAMP_EXPIRED != entry->checkedAtMillis)) {
+		if ((-1 != entry->watchDescriptor)
+			|| ((UDATA)(j9time_current_time_millis() - entry->checkedAtMillis) < _revalidateIntervalMillis)
+		) {
+			*lastModified = entry->lastModified;
+			found = true;
+		}
+	}
+	if (found) {
+		_fileChecksAvoided += 1;
+	} else {
+		_fileChecks += 1;
+	}
+	omrthread_monitor_exit(_validatedTimestampsMutex);
+
+	Trc_SHR_TMI_findValidatedTimestamp(currentThread, pathLen, path, (UDATA)(found ? 1 : 0));
+	return found;
+}
+
+/**
+ * Remember the timestamp just read for path, and watch the file for changes if inotify is in use.
+ *
+ * A change made between reading lastModified and adding the watch would not be reported, so once
+ * the watch is in place the timestamp is read again and the new value is the one remembered.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] path The path of the file
+ * @param[in] pathLen The length of path
+ * @param[in] lastModified The timestamp read
+ *
+ * @return The timestamp to use, or -1 if the file has disappeared since lastModified was read
+ */
+I_64
+SH_TimestampManagerImpl::storeValidatedTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, I_64 lastModified)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+	ValidatedTimestamp key;
+	ValidatedTimestamp* entry = NULL;
+	I_64 now = j9time_current_time_millis();
+
+	key.path = (char*)path;
+	key.pathLen = pathLen;
+
+	omrthread_monitor_enter(_validatedTimestampsMutex);
+	if (NULL == _validatedTimestamps) {
+		_validatedTimestamps = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), VALIDATED_TIMESTAMPS_INITIAL_SIZE, sizeof(ValidatedTimestamp), sizeof(char*), 0,
+				J9MEM_CATEGORY_CLASSES, validatedTimestampHashFn, validatedTimestampHashEqualFn, NULL, (void*)currentThread->javaVM->internalVMFunctions);
+	}
+	if (NULL != _validatedTimestamps) {
+		entry = (ValidatedTimestamp*)hashTableFind(_validatedTimestamps, &key);
+		if (NULL == entry) {
+			key.path = (char*)j9mem_allocate_memory(pathLen + 1, J9MEM_CATEGORY_CLASSES);
+			if (NULL != key.path) {
+				memcpy(key.path, path, pathLen + 1);
+				key.lastModified = lastModified;
+				key.checkedAtMillis = now;
+				key.watchDescriptor = -1;
+#if defined(LINUX)
+				if (-1 != _watchFD) {
+					key.watchDescriptor = (IDATA)inotify_add_watch((int)_watchFD, path, IN_ATTRIB | IN_MODIFY | IN_CLOSE_WRITE | IN_DELETE_SELF | IN_MOVE_SELF);
+					if (key.watchDescriptor < 0) {
+						key.watchDescriptor = -1;
+					} else {
+						lastModified = j9file_lastmod(path);
+						key.lastModified = lastModified;
+						if (-1 == lastModified) {
+							inotify_rm_watch((int)_watchFD, (int)key.watchDescriptor);
+							key.watchDescriptor = -1;
+						}
+					}
+				}
+#endif /* defined(LINUX) */
+				if (-1 == lastModified) {
+					j9mem_free_memory(key.path);
+				} else {
+					entry = (ValidatedTimestamp*)hashTableAdd(_validatedTimestamps, &key);
+					if (NULL == entry) {
+						j9mem_free_memory(key.path);
+					}
+				}
+			}
+		} else {
+			entry->lastModified = lastModified;
+			entry->checkedAtMillis = now;
+		}
+	}
+	omrthread_monitor_exit(_validatedTimestampsMutex);
+	return lastModified;
+}
+
+/**
+ * Expire the validated timestamps of the files for which inotify has reported a change.
+ * A file which has been replaced or deleted is no longer watched, so its timestamp is then
+ * revalidated using the revalidation interval.
+ *
+ * @pre The caller must hold _validatedTimestampsMutex
+ */
+void
+SH_TimestampManagerImpl::processWatchEvents(void)
+{
+#if defined(LINUX)
+	if ((-1 == _watchFD) || (NULL == _validatedTimestamps)) {
+		return;
+	}
+	for (;;) {
+		union {
+			struct inotify_event event;
+			char bytes[4096];
+		} buffer;
+		ssize_t length = read((int)_watchFD, buffer.bytes, sizeof(buffer.bytes));
+		char* cursor = buffer.bytes;
+
+		if (length <= 0) {
+			/* EAGAIN: no pending events */
+			break;
+		}
+		while (cursor < (buffer.bytes + length)) {
+			struct inotify_event* event = (struct inotify_event*)cursor;
+			J9HashTableState walkState;
+			ValidatedTimestamp* entry = (ValidatedTimestamp*)hashTableStartDo(_validatedTimestamps, &walkState);
+
+			while (NULL != entry) {
+				if (entry->watchDescriptor == (IDATA)event->wd) {
+					entry->checkedAtMillis = VALIDATED_TIMESTAMP_EXPIRED;
+					if (J9_ARE_ANY_BITS_SET(event->mask, IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF)) {
+						entry->watchDescriptor = -1;
+					}
+				}
+				entry = (ValidatedTimestamp*)hashTableNextDo(&walkState);
+			}
+			cursor += sizeof(struct inotify_event) + event->len;
+		}
+	}
+#endif /* defined(LINUX) */
+}
+
+/* @see TimestampManager.hpp */
+void
+SH_TimestampManagerImpl::getStatistics(UDATA* fileChecks, UDATA* fileChecksAvoided)
+{
+	*fileChecks = _fileChecks;
+	*fileChecksAvoided = _fileChecksAvoided;
+}
+
+/* @see TimestampManager.hpp */
+void
+SH_TimestampManagerImpl::cleanup(J9VMThread* currentThread)
+{
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (NULL != _validatedTimestamps) {
+		J9HashTableState walkState;
+		ValidatedTimestamp* entry = (ValidatedTimestamp*)hashTableStartDo(_validatedTimestamps, &walkState);
+
+		while (NULL != entry) {
+			j9mem_free_memory(entry->path);
+			entry = (ValidatedTimestamp*)hashTableNextDo(&walkState);
+		}
+		hashTableFree(_validatedTimestamps);
+		_validatedTimestamps = NULL;
+	}
+#if defined(LINUX)
+	if (-1 != _watchFD) {
+		/* closing the inotify instance removes its watches */
+		close((int)_watchFD);
+		_watchFD = -1;
+	}
+#endif /* defined(LINUX) */
+	if (NULL != _validatedTimestampsMutex) {
+		omrthread_monitor_destroy(_validatedTimestampsMutex);
+		_validatedTimestampsMutex = NULL;
+	}
+}
+
+/* Hash function for the validated timestamps */
+UDATA
+SH_TimestampManagerImpl::validatedTimestampHashFn(void* item, void* userData)
+{
+	ValidatedTimestamp* entry = (ValidatedTimestamp*)item;
+	J9InternalVMFunctions* internalFunctionTable = (J9InternalVMFunctions*)userData;
+
+	return internalFunctionTable->computeHashForUTF8((U_8*)entry->path, (U_16)entry->pathLen);
+}
+
+/* HashEqual function for the validated timestamps */
+UDATA
+SH_TimestampManagerImpl::validatedTimestampHashEqualFn(void* left, void* right, void* userData)
+{
+	ValidatedTimestamp* leftEntry = (ValidatedTimestamp*)left;
+	ValidatedTimestamp* rightEntry = (ValidatedTimestamp*)right;
+
+	return J9UTF8_DATA_EQUALS((U_8*)leftEntry->path, leftEntry->pathLen, (U_8*)rightEntry->path, rightEntry->pathLen);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2017 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -56,10 +56,50 @@ public:
 	/* @see TimestampManager.hpp */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper);
 
+	/* @see TimestampManager.hpp */
+	virtual void getStatistics(UDATA* fileChecks, UDATA* fileChecksAvoided);
+
+	/* @see TimestampManager.hpp */
+	virtual void cleanup(J9VMThread* currentThread);
+
 private:
+	/*
+	 * Last modified time of a JAR or jimage, remembered so that the file is not checked again
+	 * on every class lookup. Entries are keyed by path.
+	 */
+	typedef struct ValidatedTimestamp {
+		char* path;
+		UDATA pathLen;
+		I_64 lastModified;
+		I_64 checkedAtMillis;	/* VALIDATED_TIMESTAMP_EXPIRED if the timestamp must be read again */
+		IDATA watchDescriptor;	/* inotify watch of the file, -1 if not watched */
+	} ValidatedTimestamp;
 
 	I_64 localCheckTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, ROMClassWrapper* rcWrapper);
+
+	I_64 getLastModified(J9VMThread* currentThread, const char* path, bool isContainer);
+
+	bool findValidatedTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, I_64* lastModified);
+
+	I_64 storeValidatedTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, I_64 lastModified);
+
+	void processWatchEvents(void);
+
+	static UDATA validatedTimestampHashFn(void* item, void* userData);
+
+	static UDATA validatedTimestampHashEqualFn(void* left, void* right, void* userData);
+
 	J9SharedClassConfig* _sharedClassConfig;
+	J9PortLibrary* _portlib;
+	/* Protects _validatedTimestamps, the statistics and the inotify watches */
+	omrthread_monitor_t _validatedTimestampsMutex;
+	J9HashTable* _validatedTimestamps;
+	/* How long a validated timestamp is trusted, 0 disables the cache */
+	UDATA _revalidateIntervalMillis;
+	/* inotify instance used to invalidate watched timestamps, -1 if not in use */
+	IDATA _watchFD;
+	UDATA _fileChecks;
+	UDATA _fileChecksAvoided;
 };
 
 #endif /* !defined(TIMESTAMPMANAGERIMPL_HPP_INCLUDED) */
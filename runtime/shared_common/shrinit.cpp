@@ -185,6 +185,7 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_DESTROYALLLAYERS, J9NLS_SHRC_SHRINIT_HELPTEXT_DESTROYALLLAYERS, 0, 0},
 	HELPTEXT_NEWLINE,
 	{OPTION_RESET, J9NLS_SHRC_SHRINIT_HELPTEXT_RESET, 0, 0},
+	{HELPTEXT_RECLAIM_STALE_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_RECLAIM_STALE_EQUALS, 0, 0},
 	{HELPTEXT_EXPIRE_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_EXPIRE, 0, 0},
 	HELPTEXT_NEWLINE,
 #if defined(J9ZOS390)
@@ -239,6 +240,16 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_RESTRICT_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_RESTRICT_CLASSPATHS, 0, 0},
 	{OPTION_ALLOW_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_ALLOW_CLASSPATHS, 0, 0},
 	{OPTION_NO_PERSISTENT_DISK_SPACE_CHECK, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_PERSISTENT_DISK_SPACE_CHECK, 0, 0},
+#if defined(LINUX)
+	{OPTION_HUGE_PAGES, J9NLS_SHRC_SHRINIT_HELPTEXT_HUGE_PAGES, 0, 0},
+#endif /* defined(LINUX) */
+	{OPTION_PREFAULT, J9NLS_SHRC_SHRINIT_HELPTEXT_PREFAULT, 0, 0},
+	{HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0, 0},
+#if defined(LINUX)
+	{OPTION_TIMESTAMP_WATCH, J9NLS_SHRC_SHRINIT_HELPTEXT_TIMESTAMP_WATCH, 0, 0},
+#endif /* defined(LINUX) */
+	{OPTION_SHARE_ZIP_CACHE, J9NLS_SHRC_SHRINIT_HELPTEXT_SHARE_ZIP_CACHE, 0, 0},
+	{HELPTEXT_AUTO_RECLAIM_STALE_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_AUTO_RECLAIM_STALE_EQUALS, 0, 0},
 	HELPTEXT_NEWLINE,
 	{HELPTEXT_INVALIDATE_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_INVALIDATE_AOT_METHODS, 0, 0},
 	{HELPTEXT_REVALIDATE_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_REVALIDATE_AOT_METHODS, 0, 0},
@@ -376,6 +387,13 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_CREATE_LAYER, PARSE_TYPE_EXACT, RESULT_DO_CREATE_LAYER, 0 },
 #endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
 	{ OPTION_NO_PERSISTENT_DISK_SPACE_CHECK, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG, J9SHR_RUNTIMEFLAG_NO_PERSISTENT_DISK_SPACE_CHECK},
+	{ OPTION_RECLAIM_STALE_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_RECLAIM_STALE_EQUALS, 0 },
+	{ OPTION_AUTO_RECLAIM_STALE_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_AUTO_RECLAIM_STALE_EQUALS, 0 },
+	{ OPTION_HUGE_PAGES, PARSE_TYPE_EXACT, RESULT_DO_HUGE_PAGES, 0 },
+	{ OPTION_PREFAULT, PARSE_TYPE_EXACT, RESULT_DO_PREFAULT, 0 },
+	{ OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0 },
+	{ OPTION_TIMESTAMP_WATCH, PARSE_TYPE_EXACT, RESULT_DO_TIMESTAMP_WATCH, 0 },
+	{ OPTION_SHARE_ZIP_CACHE, PARSE_TYPE_EXACT, RESULT_DO_SHARE_ZIP_CACHE, 0 },
 	{ NULL, 0, 0 }
 };
 
@@ -692,6 +710,82 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, UDATA* verboseFlags,
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
 			break;
 		}
+		case RESULT_DO_HUGE_PAGES:
+		{
+			vm->sharedCacheAPI->hugePages = TRUE;
+			break;
+		}
+		case RESULT_DO_PREFAULT:
+		{
+			vm->sharedCacheAPI->prefault = TRUE;
+			break;
+		}
+		case RESULT_DO_TIMESTAMP_WATCH:
+		{
+			vm->sharedCacheAPI->timestampWatch = TRUE;
+			break;
+		}
+		case RESULT_DO_SHARE_ZIP_CACHE:
+		{
+			vm->sharedCacheAPI->shareZipCache = TRUE;
+			break;
+		}
+		case RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS:
+		{
+			UDATA temp = 0;
+			char* intervalString = options + strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+			char* cursor = intervalString;
+			if (scan_udata(&cursor, &temp) == 0) {
+				vm->sharedCacheAPI->timestampCheckInterval = temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_TIMESTAMP_CHECK_INTERVAL, OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS)+ (cursor - intervalString) +1;
+			continue;
+		}
+		case RESULT_DO_RECLAIM_STALE_EQUALS:
+		{
+			UDATA temp = 0;
+			char* percentString = options + strlen(OPTION_RECLAIM_STALE_EQUALS);
+			char* cursor = percentString;
+			if ((scan_udata(&cursor, &temp) == 0)
+				&& ('\0' == *cursor)
+				&& (temp >= 1)
+				&& (temp <= 100)
+			) {
+				vm->sharedCacheAPI->reclaimStalePercent = temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_PERCENTAGE, options);
+				return RESULT_PARSE_FAILED;
+			}
+			if (J9_ARE_ALL_BITS_SET(*runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY)) {
+				*runtimeFlags &= ~J9SHR_RUNTIMEFLAG_ENABLE_READONLY;
+				SHRINIT_WARNING_TRACE3(verboseFlags, J9NLS_SHRC_SHRINIT_OPTION_IGNORED_WARNING, OPTION_READONLY, OPTION_RECLAIM_STALE_EQUALS, OPTION_READONLY);
+			}
+			options += strlen(OPTION_RECLAIM_STALE_EQUALS)+ (cursor - percentString) +1;
+			returnAction = RESULT_DO_RECLAIM_STALE_EQUALS;
+			*runtimeFlags |= J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE;
+			continue;
+		}
+		case RESULT_DO_AUTO_RECLAIM_STALE_EQUALS:
+		{
+			UDATA temp = 0;
+			char* percentString = options + strlen(OPTION_AUTO_RECLAIM_STALE_EQUALS);
+			char* cursor = percentString;
+			if ((scan_udata(&cursor, &temp) == 0)
+				&& ('\0' == *cursor)
+				&& (temp >= 1)
+				&& (temp <= 100)
+			) {
+				vm->sharedCacheAPI->autoReclaimStalePercent = temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_PERCENTAGE, options);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_AUTO_RECLAIM_STALE_EQUALS)+ (cursor - percentString) +1;
+			continue;
+		}
 		case RESULT_DO_ADJUST_SOFTMX_EQUALS:
 		case RESULT_DO_ADJUST_MINAOT_EQUALS:
 		case RESULT_DO_ADJUST_MAXAOT_EQUALS:
@@ -2608,6 +2702,7 @@ performSharedClassesCommandLineAction(J9JavaVM* vm, J9SharedClassConfig* sharedC
 	case RESULT_DO_ADJUST_MAXAOT_EQUALS:
 	case RESULT_DO_ADJUST_MINJITDATA_EQUALS:
 	case RESULT_DO_ADJUST_MAXJITDATA_EQUALS:
+	case RESULT_DO_RECLAIM_STALE_EQUALS:
 		if (1 == checkIfCacheExists(vm, sharedClassConfig->ctrlDirName, cacheDirName, cacheName, &versionData, cacheType, layer)) {
 			return J9VMDLLMAIN_OK;
 		}
@@ -3743,6 +3838,19 @@ j9shr_init(J9JavaVM *vm, UDATA loadFlags, UDATA* nonfatal)
 		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
 	}
 
+	if (RESULT_DO_RECLAIM_STALE_EQUALS == parseResult) {
+		/* There is no need to check the return value of reclaimStaleSpace(). JVM will always exit and the corresponding NLS message
+		 * will be printed out inside reclaimStaleSpace() no matter whether the cache has been compacted */
+		cm->reclaimStaleSpace(currentThread, vm->sharedCacheAPI->reclaimStalePercent, true);
+		returnVal = J9VMDLLMAIN_SILENT_EXIT_VM;
+	} else if ((J9VMDLLMAIN_OK == returnVal)
+		&& (0 != vm->sharedCacheAPI->autoReclaimStalePercent)
+		&& J9_ARE_NO_BITS_SET(vm->sharedClassConfig->runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY)
+	) {
+		/* This JVM keeps using the cache it has attached to, JVMs started later use the compacted copy */
+		cm->reclaimStaleSpace(currentThread, vm->sharedCacheAPI->autoReclaimStalePercent, false);
+	}
+
 	return returnVal;
 
 _error:
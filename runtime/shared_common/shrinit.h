@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -194,6 +194,13 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_LAYER_EQUALS "layer="
 #define OPTION_CREATE_LAYER "createLayer"
 #define OPTION_NO_PERSISTENT_DISK_SPACE_CHECK "noPersistentDiskSpaceCheck"
+#define OPTION_RECLAIM_STALE_EQUALS "reclaimStale="
+#define OPTION_HUGE_PAGES "hugePages"
+#define OPTION_PREFAULT "prefault"
+#define OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS "timestampCheckInterval="
+#define OPTION_TIMESTAMP_WATCH "timestampWatch"
+#define OPTION_SHARE_ZIP_CACHE "shareZipCache"
+#define OPTION_AUTO_RECLAIM_STALE_EQUALS "autoReclaimStale="
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -274,6 +281,13 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_CREATE_LAYER 52
 #define RESULT_DO_PRINT_TOP_LAYER_STATS 53
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
+#define RESULT_DO_RECLAIM_STALE_EQUALS 55
+#define RESULT_DO_HUGE_PAGES 56
+#define RESULT_DO_PREFAULT 57
+#define RESULT_DO_TIMESTAMP_CHECK_INTERVAL_EQUALS 58
+#define RESULT_DO_TIMESTAMP_WATCH 59
+#define RESULT_DO_SHARE_ZIP_CACHE 60
+#define RESULT_DO_AUTO_RECLAIM_STALE_EQUALS 61
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
@@ -306,6 +320,9 @@ typedef struct J9SharedClassesOptions {
 #define HELPTEXT_ADJUST_MINJITDATA_EQUALS OPTION_ADJUST_MINJITDATA_EQUALS"<size>"
 #define HELPTEXT_ADJUST_MAXJITDATA_EQUALS OPTION_ADJUST_MAXJITDATA_EQUALS"<size>"
 #define HELPTEXT_LAYER_EQUALS OPTION_LAYER_EQUALS "<number>"
+#define HELPTEXT_RECLAIM_STALE_EQUALS OPTION_RECLAIM_STALE_EQUALS "<percent>"
+#define HELPTEXT_AUTO_RECLAIM_STALE_EQUALS OPTION_AUTO_RECLAIM_STALE_EQUALS "<percent>"
+#define HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS "<ms>"
 
 #define HELPTEXT_NEWLINE {"", 0, 0, 0, 0}
 
@@ -1,5 +1,5 @@
 ################################################################################
-# Copyright (c) 2019, 2020 IBM Corp. and others
+# Copyright (c) 2019, 2021 IBM Corp. and others
 #
 # This program and the accompanying materials are made available under
 # the terms of the Eclipse Public License 2.0 which accompanies this
@@ -28,8 +28,16 @@ omr_add_exports(j9ben
 	Java_jvmti_test_nativeMethodPrefixes_DirectNative_gac4gac3gac2gac1nat
 	Java_jvmti_test_nativeMethodPrefixes_WrappedNative_nat
 	Java_jit_test_vich_JNIObjectArray_getObjectArrayElement
+	Java_jit_test_vich_JNICritical_addJNI
+	Java_jit_test_vich_JNICritical_addCritical
+	JavaCritical_jit_test_vich_JNICritical_addCritical
+	Java_jit_test_vich_JNICritical_mixJNI
+	Java_jit_test_vich_JNICritical_mixCritical
+	JavaCritical_jit_test_vich_JNICritical_mixCritical
+	Java_jit_test_vich_JNICritical_getCriticalCallCount
 	Java_jit_test_vich_JNILocalRef_localReference32
 	Java_jit_test_vich_JNILocalRef_localReference8
+	Java_jit_test_vich_JNILocalRef_localFrame
 	Java_jit_test_vich_JNIArray_getPrimitiveArrayCritical
 	Java_jit_test_vich_JNIArray_getDoubleArrayElements
 	Java_jit_test_vich_JNIArray_getLongArrayElements
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2017 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -3488,6 +3488,25 @@ void JNICALL Java_jit_test_vich_JNIArray_getPrimitiveArrayCritical(JNIEnv *env,
 }
 
 
+void JNICALL Java_jit_test_vich_JNILocalRef_localFrame(JNIEnv *env, jobject obj, jobject o1, jint capacity, jint loopCount)
+{
+	jint i, j;
+
+	for (i = 0; i < loopCount; i++)
+	{
+		if ((*env)->PushLocalFrame(env, capacity)) {
+			return;
+		}
+		for (j = 0; j < capacity; j++)
+		{
+			(*env)->NewLocalRef(env, o1);
+		}
+		(*env)->PopLocalFrame(env, NULL);
+	}
+	return;
+}
+
+
 void JNICALL Java_jit_test_vich_JNILocalRef_localReference8(JNIEnv *env, jobject obj, jobject o1, jobject o2, jobject o3, jobject o4, jobject o5, jobject o6, jobject o7, jobject o8, jint loopCount)
 {
 	jint i;
@@ -3728,3 +3747,61 @@ void JNICALL Java_jit_test_vich_JNIObjectArray_getObjectArrayElement(JNIEnv *env
 
 
 
+
+/* Natives for jit.test.vich.JNICritical.  The *Critical natives also have a JavaCritical_ entrypoint, which
+ * is called directly from compiled code when -XX:+CriticalJNINatives is specified.  Both entrypoints of a
+ * native must compute the same result.
+ */
+
+/* Counts the calls of the JavaCritical_ entrypoints, so the test can check which entrypoint was used */
+static jlong criticalCallCount = 0;
+
+static jint
+benchAdd(jint arg1, jint arg2)
+{
+	return (jint)((unsigned int)arg1 + (unsigned int)arg2);
+}
+
+static jlong
+benchMix(jlong arg1, jlong arg2, jint arg3, jdouble arg4)
+{
+	/* unsigned arithmetic wraps around like Java long arithmetic does */
+	unsigned long long result = ((unsigned long long)arg1 ^ ((unsigned long long)arg2 << 7)) + (unsigned long long)(jlong)arg3;
+	return (jlong)((result * 31) + (unsigned long long)(jlong)arg4);
+}
+
+jint JNICALL Java_jit_test_vich_JNICritical_addJNI(JNIEnv *env, jclass clazz, jint arg1, jint arg2)
+{
+	return benchAdd(arg1, arg2);
+}
+
+jint JNICALL Java_jit_test_vich_JNICritical_addCritical(JNIEnv *env, jclass clazz, jint arg1, jint arg2)
+{
+	return benchAdd(arg1, arg2);
+}
+
+jint JNICALL JavaCritical_jit_test_vich_JNICritical_addCritical(jint arg1, jint arg2)
+{
+	criticalCallCount += 1;
+	return benchAdd(arg1, arg2);
+}
+
+jlong JNICALL Java_jit_test_vich_JNICritical_mixJNI(JNIEnv *env, jclass clazz, jlong arg1, jlong arg2, jint arg3, jdouble arg4)
+{
+	return benchMix(arg1, arg2, arg3, arg4);
+}
+
+jlong JNICALL Java_jit_test_vich_JNICritical_mixCritical(JNIEnv *env, jclass clazz, jlong arg1, jlong arg2, jint arg3, jdouble arg4)
+{
+	return benchMix(arg1, arg2, arg3, arg4);
+}
+
+jlong JNICALL JavaCritical_jit_test_vich_JNICritical_mixCritical(jlong arg1, jlong arg2, jint arg3, jdouble arg4)
+{
+	return benchMix(arg1, arg2, arg3, arg4);
+}
+
+jlong JNICALL Java_jit_test_vich_JNICritical_getCriticalCallCount(JNIEnv *env, jclass clazz)
+{
+	return criticalCallCount;
+}
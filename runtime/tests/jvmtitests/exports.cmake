@@ -1,5 +1,5 @@
 ################################################################################
-# Copyright (c) 2019, 2020 IBM Corp. and others
+# Copyright (c) 2019, 2021 IBM Corp. and others
 #
 # This program and the accompanying materials are made available under
 # the terms of the Eclipse Public License 2.0 which accompanies this
@@ -206,6 +206,14 @@ omr_add_exports(jvmtitest
 	Java_com_ibm_jvmti_tests_getSystemProperty_gsp001_cleanup
 	Java_com_ibm_jvmti_tests_eventException_ee001_invoke
 	Java_com_ibm_jvmti_tests_eventException_ee001_check
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_isSupported
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_startSampling
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_stopSampling
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_getSampleCount
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_getWalkedCount
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_getInvalidCount
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_verifySamples
+	Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_jvmtiSample
 )
 
 if(NOT JAVA_SPEC_VERSION LESS 9)
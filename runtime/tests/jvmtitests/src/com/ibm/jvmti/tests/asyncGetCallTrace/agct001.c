@@ -0,0 +1,333 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/* Sampling profiler agent built on AsyncGetCallTrace. A SIGPROF timer interrupts the running
+ * threads and the signal handler walks the interrupted thread's stack. The agent also exposes
+ * a JVMTI GetAllStackTraces sampler so the Java side can compare the overhead of the two.
+ */
+#include "j9cfg.h"
+
+#if defined(LINUX) && defined(J9VM_ARCH_X86) && defined(J9VM_ENV_DATA64)
+#define _GNU_SOURCE
+#define AGCT001_SUPPORTED
+#endif /* defined(LINUX) && defined(J9VM_ARCH_X86) && defined(J9VM_ENV_DATA64) */
+
+#include <string.h>
+
+#if defined(AGCT001_SUPPORTED)
+#include <dlfcn.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/time.h>
+#endif /* defined(AGCT001_SUPPORTED) */
+
+#include "jvmti_test.h"
+
+#define AGCT001_MAX_FRAMES 64
+#define AGCT001_MAX_RECORDED_METHODS 8192
+
+/* The AsyncGetCallTrace error codes, returned in num_frames */
+#define AGCT001_TICKS_UNKNOWN_STATE -7
+#define AGCT001_TICKS_SAFEPOINT -10
+
+typedef struct {
+	jint lineno;
+	jmethodID method_id;
+} ASGCT_CallFrame;
+
+typedef struct {
+	JNIEnv *env_id;
+	jint num_frames;
+	ASGCT_CallFrame *frames;
+} ASGCT_CallTrace;
+
+typedef void (*AsyncGetCallTraceFunction)(ASGCT_CallTrace *trace, jint depth, void *ucontext);
+
+static agentEnv * env;
+static AsyncGetCallTraceFunction asyncGetCallTrace;
+static volatile jint sampleCount;
+static volatile jint walkedCount;
+static volatile jint invalidCount;
+static volatile jint recordedCount;
+static jmethodID recordedMethods[AGCT001_MAX_RECORDED_METHODS];
+
+static void JNICALL classPrepare(jvmtiEnv *jvmti_env, JNIEnv* jni_env, jthread thread, jclass klass);
+
+jint JNICALL
+agct001(agentEnv * agent_env, char * args)
+{
+	JVMTI_ACCESS_FROM_AGENT(agent_env);
+	jvmtiEventCallbacks callbacks;
+	jvmtiError err;
+
+	env = agent_env;
+	asyncGetCallTrace = NULL;
+
+#if defined(AGCT001_SUPPORTED)
+	asyncGetCallTrace = (AsyncGetCallTraceFunction)dlsym(RTLD_DEFAULT, "AsyncGetCallTrace");
+	if (NULL == asyncGetCallTrace) {
+		void *handle = dlopen("libjvm.so", RTLD_LAZY | RTLD_NOLOAD);
+		if (NULL != handle) {
+			asyncGetCallTrace = (AsyncGetCallTraceFunction)dlsym(handle, "AsyncGetCallTrace");
+		}
+	}
+	if (NULL == asyncGetCallTrace) {
+		error(env, JVMTI_ERROR_NOT_AVAILABLE, "Failed to find AsyncGetCallTrace");
+		return JNI_ERR;
+	}
+#endif /* defined(AGCT001_SUPPORTED) */
+
+	/* AsyncGetCallTrace only reports existing method IDs, so create them as classes are prepared */
+	memset(&callbacks, 0, sizeof(jvmtiEventCallbacks));
+	callbacks.ClassPrepare = classPrepare;
+	err = (*jvmti_env)->SetEventCallbacks(jvmti_env, &callbacks, sizeof(jvmtiEventCallbacks));
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to set callback for ClassPrepare events");
+		return JNI_ERR;
+	}
+
+	err = (*jvmti_env)->SetEventNotificationMode(jvmti_env, JVMTI_ENABLE, JVMTI_EVENT_CLASS_PREPARE, NULL);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to enable ClassPrepare event");
+		return JNI_ERR;
+	}
+
+	return JNI_OK;
+}
+
+static void
+createMethodIDs(jvmtiEnv *jvmti_env, jclass klass)
+{
+	jint methodCount = 0;
+	jmethodID *methods = NULL;
+
+	if (JVMTI_ERROR_NONE == (*jvmti_env)->GetClassMethods(jvmti_env, klass, &methodCount, &methods)) {
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)methods);
+	}
+}
+
+static void JNICALL
+classPrepare(jvmtiEnv *jvmti_env, JNIEnv* jni_env, jthread thread, jclass klass)
+{
+	createMethodIDs(jvmti_env, klass);
+}
+
+#if defined(AGCT001_SUPPORTED)
+static void
+sampleHandler(int sig, siginfo_t *info, void *ucontext)
+{
+	ASGCT_CallFrame frames[AGCT001_MAX_FRAMES];
+	ASGCT_CallTrace trace;
+	int savedErrno = errno;
+
+	trace.env_id = NULL;
+	trace.num_frames = 0;
+	trace.frames = frames;
+	asyncGetCallTrace(&trace, AGCT001_MAX_FRAMES, ucontext);
+
+	__sync_fetch_and_add(&sampleCount, 1);
+	if (trace.num_frames > 0) {
+		jint i = 0;
+		if (trace.num_frames > AGCT001_MAX_FRAMES) {
+			__sync_fetch_and_add(&invalidCount, 1);
+		} else {
+			for (i = 0; i < trace.num_frames; i++) {
+				if (NULL == frames[i].method_id) {
+					break;
+				}
+			}
+			if (i == trace.num_frames) {
+				__sync_fetch_and_add(&walkedCount, 1);
+				/* keep the method IDs so that they can be checked with JVMTI once sampling has stopped */
+				for (i = 0; i < trace.num_frames; i++) {
+					jint index = __sync_fetch_and_add(&recordedCount, 1);
+					if (index >= AGCT001_MAX_RECORDED_METHODS) {
+						break;
+					}
+					recordedMethods[index] = frames[i].method_id;
+				}
+			} else {
+				__sync_fetch_and_add(&invalidCount, 1);
+			}
+		}
+	} else if ((trace.num_frames < AGCT001_TICKS_SAFEPOINT) || (AGCT001_TICKS_UNKNOWN_STATE == trace.num_frames)) {
+		/* not one of the documented error codes, or a state the walk could not classify */
+		__sync_fetch_and_add(&invalidCount, 1);
+	}
+
+	errno = savedErrno;
+}
+
+static jboolean
+setSampleTimer(jint intervalMicros)
+{
+	struct itimerval timer;
+
+	timer.it_interval.tv_sec = intervalMicros / 1000000;
+	timer.it_interval.tv_usec = intervalMicros % 1000000;
+	timer.it_value = timer.it_interval;
+	return (0 == setitimer(ITIMER_PROF, &timer, NULL)) ? JNI_TRUE : JNI_FALSE;
+}
+#endif /* defined(AGCT001_SUPPORTED) */
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_isSupported(JNIEnv *jni_env, jclass cls)
+{
+#if defined(AGCT001_SUPPORTED)
+	return JNI_TRUE;
+#else /* defined(AGCT001_SUPPORTED) */
+	return JNI_FALSE;
+#endif /* defined(AGCT001_SUPPORTED) */
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_startSampling(JNIEnv *jni_env, jclass cls, jint intervalMicros)
+{
+#if defined(AGCT001_SUPPORTED)
+	jvmtiEnv *jvmti_env = env->jvmtiEnv;
+	struct sigaction action;
+	jint classCount = 0;
+	jclass *classes = NULL;
+	jvmtiError err;
+
+	/* classes prepared before the agent was loaded have not had their method IDs created yet */
+	err = (*jvmti_env)->GetLoadedClasses(jvmti_env, &classCount, &classes);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to GetLoadedClasses");
+		return JNI_FALSE;
+	} else {
+		jint i = 0;
+		for (i = 0; i < classCount; i++) {
+			createMethodIDs(jvmti_env, classes[i]);
+		}
+		(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)classes);
+	}
+
+	sampleCount = 0;
+	walkedCount = 0;
+	invalidCount = 0;
+	recordedCount = 0;
+	memset(recordedMethods, 0, sizeof(recordedMethods));
+
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = sampleHandler;
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	if (0 != sigaction(SIGPROF, &action, NULL)) {
+		error(env, JVMTI_ERROR_INTERNAL, "Failed to install the SIGPROF handler");
+		return JNI_FALSE;
+	}
+	if (!setSampleTimer(intervalMicros)) {
+		error(env, JVMTI_ERROR_INTERNAL, "Failed to start the profiling timer");
+		return JNI_FALSE;
+	}
+	return JNI_TRUE;
+#else /* defined(AGCT001_SUPPORTED) */
+	return JNI_FALSE;
+#endif /* defined(AGCT001_SUPPORTED) */
+}
+
+void JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_stopSampling(JNIEnv *jni_env, jclass cls)
+{
+#if defined(AGCT001_SUPPORTED)
+	setSampleTimer(0);
+#endif /* defined(AGCT001_SUPPORTED) */
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_getSampleCount(JNIEnv *jni_env, jclass cls)
+{
+	return sampleCount;
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_getWalkedCount(JNIEnv *jni_env, jclass cls)
+{
+	return walkedCount;
+}
+
+jint JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_getInvalidCount(JNIEnv *jni_env, jclass cls)
+{
+	return invalidCount;
+}
+
+/**
+ * Check that every method ID recorded by the signal handler names a real method, and count the
+ * ones which do not as invalid samples. Must be called after sampling has stopped.
+ *
+ * @return the number of method IDs checked
+ */
+jint JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_verifySamples(JNIEnv *jni_env, jclass cls)
+{
+	jvmtiEnv *jvmti_env = env->jvmtiEnv;
+	jint count = recordedCount;
+	jint checked = 0;
+	jint i = 0;
+
+	if (count > AGCT001_MAX_RECORDED_METHODS) {
+		count = AGCT001_MAX_RECORDED_METHODS;
+	}
+	for (i = 0; i < count; i++) {
+		jmethodID method = recordedMethods[i];
+		char *name = NULL;
+		jclass declaringClass = NULL;
+		jvmtiError err;
+
+		/* a signal delivered while the timer was being stopped may not have filled in its slot */
+		if (NULL == method) {
+			continue;
+		}
+		checked += 1;
+		err = (*jvmti_env)->GetMethodName(jvmti_env, method, &name, NULL, NULL);
+		if (JVMTI_ERROR_NONE == err) {
+			(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)name);
+			err = (*jvmti_env)->GetMethodDeclaringClass(jvmti_env, method, &declaringClass);
+		}
+		if (JVMTI_ERROR_NONE == err) {
+			(*jni_env)->DeleteLocalRef(jni_env, declaringClass);
+		} else {
+			error(env, err, "Recorded method ID %p is not valid", method);
+			invalidCount += 1;
+		}
+	}
+	return checked;
+}
+
+jboolean JNICALL
+Java_com_ibm_jvmti_tests_asyncGetCallTrace_agct001_jvmtiSample(JNIEnv *jni_env, jclass cls)
+{
+	jvmtiEnv *jvmti_env = env->jvmtiEnv;
+	jvmtiStackInfo *stackInfo = NULL;
+	jint threadCount = 0;
+	jvmtiError err;
+
+	err = (*jvmti_env)->GetAllStackTraces(jvmti_env, AGCT001_MAX_FRAMES, &stackInfo, &threadCount);
+	if (err != JVMTI_ERROR_NONE) {
+		error(env, err, "Failed to GetAllStackTraces");
+		return JNI_FALSE;
+	}
+	(*jvmti_env)->Deallocate(jvmti_env, (unsigned char *)stackInfo);
+	return JNI_TRUE;
+}
@@ -2459,6 +2459,7 @@ swapClassesForFastHCR(J9Class *originalClass, J9Class *obsoleteClass)
 	SWAP_MEMBER(jniIDs, void **, originalClass, obsoleteClass);
 	SWAP_MEMBER(romClass, J9ROMClass *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramMethods, J9Method *, originalClass, obsoleteClass);
+	SWAP_MEMBER(methodLookupIndex, J9MethodLookupIndex *, originalClass, obsoleteClass);
 	SWAP_MEMBER(ramConstantPool, J9ConstantPool *, originalClass, obsoleteClass);
 	((J9ConstantPool *) originalClass->ramConstantPool)->ramClass = originalClass;
 	((J9ConstantPool *) obsoleteClass->ramConstantPool)->ramClass = obsoleteClass;
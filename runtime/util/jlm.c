@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -117,6 +117,12 @@
 #define JLM_DUMP_FORMAT_SIZE       8
 /* version */
 #define JLM_DUMP_VERSION           1
+/* version of COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY dumps */
+#define JLM_DUMP_LOCK_POLICY_VERSION 2
+/* 8 byte count of monitors deflated by the GC, following the 2 integer fields */
+#define JLM_DUMP_LOCK_POLICY_HEADER_SIZE 8
+/* 2 spin acquired + 2 spin failed + 2 reserved + 2 cancel + 1 inflated = 9 */
+#define JLM_DUMP_LOCK_POLICY_FIELD_SIZE 9
 
 
 static void GetMonitorName (J9VMThread *vmThread, J9ThreadAbstractMonitor *monitor, char *nameBuf);
@@ -148,7 +154,11 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 	held = 1;
 
 	/* Write the header fields if not the original format */
-	if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
+	if (dump_format == COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY) {
+		WRITE_4BYTES(JLM_DUMP_LOCK_POLICY_VERSION);
+		WRITE_4BYTES(dump_format);
+		WRITE_8BYTES(jvm->thrGCDeflatedMonitorCount);
+	} else if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 		WRITE_4BYTES(JLM_DUMP_VERSION);
 		WRITE_4BYTES(dump_format);
 	}
@@ -180,7 +190,7 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 			/* If format with tags is required, write the tag (8 bytes),
 			   otherwise write 0 in the objectid field - 4 or 8 bytes */
-			if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
+			if ((dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) || (dump_format == COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY)) {
 				jlong tag = 0;
 					if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
 					j9object_t object = J9WEAKROOT_OBJECT_LOAD(vmThread, &monitor->userData);
@@ -206,6 +216,25 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 				WRITE_8BYTES(tag);
 
+				/* The lock policy format adds the contention history of the object's class and whether the monitor is inflated */
+				if (dump_format == COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY) {
+					J9Class *clazz = NULL;
+					if (monitor->flags & J9THREAD_MONITOR_OBJECT) {
+						j9object_t object = J9WEAKROOT_OBJECT_LOAD(vmThread, &monitor->userData);
+						if (NULL != object) {
+							clazz = J9OBJECT_CLAZZ(vmThread, object);
+						}
+					}
+					if (NULL != clazz) {
+						WRITE_2BYTES(clazz->spinAcquiredCounter);
+						WRITE_2BYTES(clazz->spinFailedCounter);
+						WRITE_2BYTES(clazz->reservedCounter);
+						WRITE_2BYTES(clazz->cancelCounter);
+					} else {
+						WRITE_8BYTES(0);
+					}
+					WRITE_1BYTE((monitor->flags & J9THREAD_MONITOR_INFLATED) ? 1 : 0);
+				}
 			} else {
 				/* The next field has a pointer size */
 				if (sizeof(void *) == 4) {
@@ -242,6 +271,10 @@ request_MonitorJlmDump(jvmtiEnv * env, J9VMJlmDump * jlmd, jint dump_format)
 
 		if (dump_format == COM_IBM_JLM_DUMP_FORMAT_TAGS) {
 			WRITE_8BYTES(0);
+		} else if (dump_format == COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY) {
+			WRITE_8BYTES(0);
+			WRITE_8BYTES(0);
+			WRITE_1BYTE(0);
 		} else {
 			/* The next field has a pointer size */
 			if (sizeof(void *) == 8) {
@@ -407,7 +440,10 @@ jint request_MonitorJlmDumpSize(J9JavaVM * jvm, UDATA * dump_size, jint dump_for
 	vmThread = jvm->internalVMFunctions->currentVMThread(jvm);
 
 	/* Count the header fields if not the original format */
-	if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
+	if (dump_format == COM_IBM_JLM_DUMP_FORMAT_LOCK_POLICY) {
+		*dump_size    = JLM_DUMP_FORMAT_SIZE + JLM_DUMP_LOCK_POLICY_HEADER_SIZE;
+		objIDfieldSize = 8 + JLM_DUMP_LOCK_POLICY_FIELD_SIZE;
+	} else if (dump_format != COM_IBM_JLM_DUMP_FORMAT_OBJECT_ID) {
 		*dump_size    = JLM_DUMP_FORMAT_SIZE;
 		objIDfieldSize = 8;
 	} else {
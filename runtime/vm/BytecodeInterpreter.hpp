@@ -5499,6 +5499,43 @@ done:
 		return EXECUTE_BYTECODE;
 	}
 
+	/* The long, float and double compares are nearly always followed by a branch on the
+	 * result, so run that branch as part of the compare rather than dispatching it separately.
+	 * The branch bytecode still profiles itself, and single stepping needs it to be dispatched.
+	 *
+	 * The pair is fused at dispatch time only, it is not quickened into a new bytecode: the ROM
+	 * bytecodes are read-only and may be shared by several JVMs through the shared classes cache,
+	 * and a new bytecode would have to be taught to the verifier, the JIT, JVMTI (breakpoints and
+	 * the original bytecodes) and the bytecode tools. The only quickened pair, aload_0; getfield
+	 * (JBaload0getfield), is formed when the ROM class is built, so it is already what the shared
+	 * cache stores.
+	 *
+	 * ..., result => ... (if a branch follows)
+	 */
+	VMINLINE VM_BytecodeAction
+	branchOnCompareResult(REGISTER_ARGS_LIST)
+	{
+#if !defined(DO_SINGLE_STEP)
+		switch (*_pc) {
+		case JBifeq:
+			return ifeq(REGISTER_ARGS);
+		case JBifne:
+			return ifne(REGISTER_ARGS);
+		case JBiflt:
+			return iflt(REGISTER_ARGS);
+		case JBifge:
+			return ifge(REGISTER_ARGS);
+		case JBifgt:
+			return ifgt(REGISTER_ARGS);
+		case JBifle:
+			return ifle(REGISTER_ARGS);
+		default:
+			break;
+		}
+#endif /* !DO_SINGLE_STEP */
+		return EXECUTE_BYTECODE;
+	}
+
 	/* ..., lhs1, lhs2, rhs1, rhs2 => ..., result */
 	VMINLINE VM_BytecodeAction
 	lcmp(REGISTER_ARGS_LIST)
@@ -5514,7 +5551,7 @@ done:
 		} else {
 			*(I_32*)_sp = -1;
 		}
-		return EXECUTE_BYTECODE;
+		return branchOnCompareResult(REGISTER_ARGS);
 	}
 
 	/* ..., lhs, rhs => ..., result */
@@ -5528,7 +5565,7 @@ done:
 			result = nanValue;
 		}
 		*(I_32*)_sp = result;
-		return EXECUTE_BYTECODE;
+		return branchOnCompareResult(REGISTER_ARGS);
 	}
 
 	/* ..., lhs, lhs2, rhs1, rhs2 => ..., result */
@@ -5542,7 +5579,7 @@ done:
 			result = nanValue;
 		}
 		*(I_32*)_sp = result;
-		return EXECUTE_BYTECODE;
+		return branchOnCompareResult(REGISTER_ARGS);
 	}
 
 	/* ..., arrayref, index => ..., value */
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -208,6 +208,30 @@ found:
 
 		if ((0 == flags) && (0 != (((UDATA)jniNativeMethod->constantPool) & J9_STARTPC_JNI_NATIVE))) {
 			address = jniNativeMethod->extra;
+			/* When enabled, a JavaCritical_ entrypoint is called like a fast JNI native which takes no JNIEnv or class */
+			if (J9_ARE_ANY_BITS_SET(currentThread->javaVM->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_CRITICAL_JNI_NATIVES)) {
+				void *criticalAddress = lookupCriticalNativeAddress(currentThread, jniNativeMethod);
+				if (NULL != criticalAddress) {
+					J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+					J9UTF8 *methodSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+					address = criticalAddress;
+					flags = J9_FAST_JNI_RETAIN_VM_ACCESS
+							| J9_FAST_JNI_NOT_GC_POINT
+							| J9_FAST_JNI_NO_NATIVE_METHOD_FRAME
+							| J9_FAST_JNI_NO_EXCEPTION_THROW
+							| J9_FAST_JNI_NO_SPECIAL_TEAR_DOWN
+							| J9_FAST_JNI_DO_NOT_WRAP_OBJECTS
+							| J9_FAST_JNI_DO_NOT_PASS_RECEIVER
+							| J9_FAST_JNI_DO_NOT_PASS_THREAD;
+					Trc_VM_fastJNINativeFound(
+							currentThread, jniNativeMethod,
+							classNameLength, classNameData,
+							J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName),
+							J9UTF8_LENGTH(methodSignature), J9UTF8_DATA(methodSignature),
+							flags, address);
+					goto done;
+				}
+			}
 #if defined(DEBUG)
 			{
 				PORT_ACCESS_FROM_VMC(currentThread);
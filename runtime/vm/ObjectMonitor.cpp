@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -507,9 +507,10 @@ spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9ob
 	UDATA spinCount2 = vm->thrMaxSpins2BeforeBlocking;
 	UDATA yieldCount = vm->thrMaxYieldsBeforeBlocking;
 	UDATA const nestedSpinning = vm->thrNestedSpinning;
+	J9Class *ramClass = J9OBJECT_CLAZZ(currentThread, object);
+	bool adaptiveSpin = (0 != vm->thrAdaptiveSpinning);
 
 #if defined(J9VM_INTERP_CUSTOM_SPIN_OPTIONS)
-	J9Class *ramClass = J9OBJECT_CLAZZ(currentThread, object);
 	J9VMCustomSpinOptions *option = ramClass->customSpinOption;
 	UDATA spinCount1 = vm->thrMaxSpins1BeforeBlocking;
 
@@ -519,6 +520,8 @@ spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9ob
 		spinCount1 = j9monitorOptions->thrMaxSpins1BeforeBlocking;
 		spinCount2 = j9monitorOptions->thrMaxSpins2BeforeBlocking;
 		yieldCount = j9monitorOptions->thrMaxYieldsBeforeBlocking;
+		/* custom spin options are never overridden by the adaptive spin */
+		adaptiveSpin = false;
 
 		Trc_VM_MonitorEnterNonBlocking_CustomSpinOption_Set1(option->className,
 				object,
@@ -530,6 +533,12 @@ spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9ob
 	UDATA const spinCount1 = vm->thrMaxSpins1BeforeBlocking;
 #endif /* J9VM_INTERP_CUSTOM_SPIN_OPTIONS */
 
+	/* Spinning on the locks of this class has mostly ended in blocking, so only spin without yielding before inflating */
+	if (adaptiveSpin && (yieldCount > 1) && VM_ObjectMonitor::shouldShortenSpin(ramClass)) {
+		Trc_VM_spinOnFlatLock_shortenedSpin(currentThread, ramClass, ramClass->spinAcquiredCounter, ramClass->spinFailedCounter);
+		yieldCount = 1;
+	}
+
 	j9objectmonitor_t bits = OBJECT_HEADER_LOCK_FLC + OBJECT_HEADER_LOCK_INFLATED;
 #if defined(J9VM_THR_LOCK_RESERVATION)
 	bits += OBJECT_HEADER_LOCK_RESERVED;
@@ -556,7 +565,7 @@ spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9ob
 							rc = true;
 
 							/* Transition from Learning to Flat occurred so the Cancel Counter in the object's J9Class is incremented by 1. */
-							VM_ObjectMonitor::incrementCancelCounter(J9OBJECT_CLAZZ(currentThread, object));
+							VM_ObjectMonitor::incrementCancelCounter(ramClass);
 							goto done;
 						}
 					} else {
@@ -573,7 +582,7 @@ spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9ob
 
 						if (lock == VM_ObjectMonitor::compareAndSwapLockword(currentThread, lwEA, lock, newLock, false)) {
 							/* Transition from Learning to Flat occurred so the Cancel Counter in the object's J9Class is incremented by 1. */
-							VM_ObjectMonitor::incrementCancelCounter(J9OBJECT_CLAZZ(currentThread, object));
+							VM_ObjectMonitor::incrementCancelCounter(ramClass);
 						}
 					}
 				}
@@ -603,6 +612,9 @@ spinOnFlatLock(J9VMThread *currentThread, j9objectmonitor_t volatile *lwEA, j9ob
 	}
 
 done:
+	if (adaptiveSpin) {
+		VM_ObjectMonitor::recordSpinOutcome(ramClass, rc);
+	}
 	return rc;
 }
 
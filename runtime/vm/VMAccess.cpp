@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2020 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -55,6 +55,8 @@ extern "C" {
 
 static void initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread);
 static U_64 updateExclusiveVMAccessStats(J9VMThread* currentThread);
+static UDATA lastResponderFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState);
+static void recordExclusiveVMAccessResponseTime(J9JavaVM* vm, J9VMThread* currentThread);
 
 #if (defined(J9VM_DBG))
 static void badness (char *description);
@@ -96,6 +98,7 @@ initializeExclusiveVMAccessStats(J9JavaVM* vm, J9VMThread* currentThread)
 	vm->omrVM->exclusiveVMAccessStats.requester = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 	vm->omrVM->exclusiveVMAccessStats.lastResponder = (NULL == currentThread ? NULL : currentThread->omrVMThread);
 	vm->omrVM->exclusiveVMAccessStats.haltedThreads = 0;
+	vm->exclusiveAccessLastResponseReason = 0;
 }
 
 /**
@@ -113,6 +116,105 @@ updateExclusiveVMAccessStats(J9VMThread* currentThread)
 	return VM_VMAccess::updateExclusiveVMAccessStats(currentThread, vm, PORTLIB);
 }
 
+typedef struct LastResponderFrame {
+	J9Method *method;
+	UDATA bytecodeIndex;
+	UDATA isCompiled;
+} LastResponderFrame;
+
+static UDATA
+lastResponderFrameIterator(J9VMThread *currentThread, J9StackWalkState *walkState)
+{
+	LastResponderFrame *frame = (LastResponderFrame *)walkState->userData1;
+
+	frame->method = walkState->method;
+	frame->bytecodeIndex = (UDATA)walkState->bytecodePCOffset;
+	frame->isCompiled = (NULL != walkState->jitInfo);
+
+	return J9_STACKWALK_STOP_ITERATING;
+}
+
+/**
+ * Add the time all threads took to respond to the exclusive request which has just been granted
+ * to the response time histogram. If the response was slow, the last thread to respond and the
+ * method it was running are reported through tracepoints and J9HOOK_VM_SLOW_EXCLUSIVE_LAST_RESPONDER.
+ * Must be called with the vmThreadListMutex held, once exclusive access has been granted.
+ *
+ * @parm[in] vm the J9JavaVM
+ * @parm[in] currentThread the thread which acquired exclusive access, or NULL if external
+ */
+static void
+recordExclusiveVMAccessResponseTime(J9JavaVM* vm, J9VMThread* currentThread)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_64 timeTaken = j9time_hires_delta(vm->omrVM->exclusiveVMAccessStats.startTime, vm->omrVM->exclusiveVMAccessStats.endTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+	UDATA haltedThreads = vm->omrVM->exclusiveVMAccessStats.haltedThreads;
+	UDATA reason = vm->exclusiveAccessLastResponseReason;
+	UDATA bucket = 0;
+
+	while ((bucket < (J9_XACCESS_RESPONSE_HISTOGRAM_BUCKETS - 1)) && (timeTaken >= ((U_64)1 << bucket))) {
+		bucket += 1;
+	}
+	vm->exclusiveAccessResponseHistogram[bucket] += 1;
+	if (timeTaken > vm->exclusiveAccessMaxResponseTime) {
+		vm->exclusiveAccessMaxResponseTime = timeTaken;
+	}
+	Trc_VM_exclusiveAccessResponseTime(currentThread, timeTaken, haltedThreads, reason);
+
+	UDATA slowTolerance = J9_EXCLUSIVE_SLOW_TOLERANCE_STANDARD;
+	if (OMR_GC_ALLOCATION_TYPE_SEGREGATED == vm->gcAllocationType) {
+		slowTolerance = J9_EXCLUSIVE_SLOW_TOLERANCE_REALTIME;
+	}
+	if (timeTaken > ((U_64)slowTolerance * 1000)) {
+		OMR_VMThread *lastOMRResponder = vm->omrVM->exclusiveVMAccessStats.lastResponder;
+		J9VMThread *lastResponder = NULL;
+		LastResponderFrame frame = { NULL, 0, FALSE };
+
+		/* the last responder may have exited since it responded, so only trust it if it is still in the thread list */
+		if ((NULL != lastOMRResponder) && ((NULL == currentThread) || (lastOMRResponder != currentThread->omrVMThread))) {
+			J9VMThread *walkThread = vm->mainThread;
+			do {
+				if (walkThread->omrVMThread == lastOMRResponder) {
+					lastResponder = walkThread;
+					break;
+				}
+				walkThread = walkThread->linkNext;
+			} while (walkThread != vm->mainThread);
+		}
+
+		/* the last responder is halted, so its stack is walkable */
+		if ((NULL != lastResponder) && (NULL != currentThread)) {
+			J9StackWalkState walkState;
+			walkState.walkThread = lastResponder;
+			walkState.skipCount = 0;
+			walkState.maxFrames = 1;
+			walkState.userData1 = (void *)&frame;
+			walkState.frameWalkFunction = lastResponderFrameIterator;
+			walkState.flags = J9_STACKWALK_ITERATE_FRAMES | J9_STACKWALK_VISIBLE_ONLY | J9_STACKWALK_COUNT_SPECIFIED | J9_STACKWALK_RECORD_BYTECODE_PC_OFFSET;
+			vm->walkStackFrames(currentThread, &walkState);
+		}
+
+		if (NULL != frame.method) {
+			J9UTF8 *className = J9ROMCLASS_CLASSNAME(J9_CLASS_FROM_METHOD(frame.method)->romClass);
+			J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(frame.method);
+			J9UTF8 *methodName = J9ROMMETHOD_NAME(romMethod);
+			J9UTF8 *methodSig = J9ROMMETHOD_SIGNATURE(romMethod);
+			Trc_VM_exclusiveAccessSlowLastResponderMethod(currentThread, lastResponder,
+					J9UTF8_LENGTH(className), J9UTF8_DATA(className),
+					J9UTF8_LENGTH(methodName), J9UTF8_DATA(methodName),
+					J9UTF8_LENGTH(methodSig), J9UTF8_DATA(methodSig),
+					frame.bytecodeIndex, frame.isCompiled);
+		} else {
+			Trc_VM_exclusiveAccessSlowLastResponder(currentThread, lastResponder, timeTaken);
+		}
+
+		/* the event consumers need a thread to report on */
+		if (NULL != currentThread) {
+			TRIGGER_J9HOOK_VM_SLOW_EXCLUSIVE_LAST_RESPONDER(vm->hookInterface, currentThread, lastResponder, (UDATA)timeTaken, haltedThreads, reason, frame.method, frame.bytecodeIndex, frame.isCompiled);
+		}
+	}
+}
+
 
 void  
 acquireExclusiveVMAccess(J9VMThread * vmThread)
@@ -324,6 +426,7 @@ acquireExclusiveVMAccess(J9VMThread * vmThread)
 		omrthread_monitor_enter(vm->vmThreadListMutex);
 
 		vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+		recordExclusiveVMAccessResponseTime(vm, vmThread);
 	}
 	Assert_VM_true(J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState);
 	Trc_VM_acquireExclusiveVMAccess_Exit(vmThread);
@@ -373,6 +476,7 @@ void   internalAcquireVMAccessNoMutexWithMask(J9VMThread * vmThread, UDATA haltM
 				if (timeTaken > slowTolerance) {
 					TRIGGER_J9HOOK_VM_SLOW_EXCLUSIVE(vm->hookInterface, vmThread, (UDATA) timeTaken, J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL);
 				}
+				vm->exclusiveAccessLastResponseReason = J9_EXCLUSIVE_SLOW_REASON_JNICRITICAL;
 				omrthread_monitor_notify_all(vm->exclusiveAccessMutex);
 			}
 			omrthread_monitor_exit(vm->exclusiveAccessMutex);
@@ -724,6 +828,7 @@ waitForResponseFromExternalThread(J9JavaVM * vm, UDATA vmResponsesExpected, UDAT
 	omrthread_monitor_enter(vm->vmThreadListMutex);
 
 	vm->omrVM->exclusiveVMAccessStats.endTime = j9time_hires_clock();
+	recordExclusiveVMAccessResponseTime(vm, NULL);
 }
 
 void
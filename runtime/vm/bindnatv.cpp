@@ -70,6 +70,9 @@ static UDATA nativeMethodHash(void *key, void *userData);
 static UDATA nativeMethodEqual(void *leftKey, void *rightKey, void *userData);
 static UDATA bindNative(J9VMThread *currentThread, J9Method *nativeMethod, char * longJNI, char * shortJNI, UDATA bindJNINative);
 static UDATA lookupNativeAddress(J9VMThread *currentThread, J9Method *nativeMethod, J9NativeLibrary *handle, char *longJNI, char *shortJNI, UDATA functionArgCount, UDATA bindJNINative);
+static void bindCriticalNative(J9VMThread *currentThread, J9Method *nativeMethod, J9NativeLibrary *nativeLibrary, char *longJNI, char *shortJNI);
+static UDATA criticalNativeHash(void *key, void *userData);
+static UDATA criticalNativeEqual(void *leftKey, void *rightKey, void *userData);
 
 #if JAVA_SPEC_VERSION >= 15
 J9_DECLARE_CONSTANT_UTF8(j9_findnative_sig, "(Ljava/lang/ClassLoader;Ljava/lang/String;)J");
@@ -784,6 +787,11 @@ typedef struct J9NativeMethodBindEntry {
 	char * shortJNIName;		/* Undecorated JNI function name */
 } J9NativeMethodBindEntry ;
 
+typedef struct J9CriticalNativeEntry {
+	J9Method * nativeMethod;	/* The bound JNI native */
+	void * criticalAddress;		/* The JavaCritical_ entrypoint of the native */
+} J9CriticalNativeEntry;
+
 /**
  * Initialize the native method bind table.
  * \param vm
@@ -834,6 +842,31 @@ nativeMethodEqual(void *leftKey, void *rightKey, void *userData)
 	return ((J9NativeMethodBindEntry*)leftKey)->nativeMethod == ((J9NativeMethodBindEntry*)rightKey)->nativeMethod;
 }
 
+/**
+ * Compute the hash code for the supplied \c J9CriticalNativeEntry.
+ * \param key
+ * \param userData
+ * \return A hash value for the J9CriticalNativeEntry.
+ */
+static UDATA
+criticalNativeHash(void *key, void *userData)
+{
+	return (UDATA)((J9CriticalNativeEntry*)key)->nativeMethod;
+}
+
+/**
+ * Determines if \c leftKey and \c rightKey refer to the same critical native entry.
+ * \param leftKey The first key to compare.
+ * \param rightKey The second key to compare.
+ * \param userData
+ * \return Non-zero if the entries are equal, zero otherwise.
+ */
+static UDATA
+criticalNativeEqual(void *leftKey, void *rightKey, void *userData)
+{
+	return ((J9CriticalNativeEntry*)leftKey)->nativeMethod == ((J9CriticalNativeEntry*)rightKey)->nativeMethod;
+}
+
 /**
  * Resolves the native entrypoint for the Java \c nativeMethod.  Compile-time
  * resolves will not generate VM hook events.
@@ -1013,6 +1046,9 @@ bindNative(J9VMThread *currentThread, J9Method *nativeMethod, char *longJNI, cha
 			UDATA rc = lookupNativeAddress(currentThread, nativeMethod, nativeLibrary, longJNI, shortJNI, argCount, bindJNINative);
 			if (J9_NATIVE_METHOD_IS_BOUND(nativeMethod)) {
 				Trc_VM_bindNative_NativeLibrary_Success(currentThread, nativeMethod, nativeLibrary, longJNI, shortJNI, bindJNINative);
+				if (J9_ARE_ANY_BITS_SET((UDATA)nativeMethod->constantPool, J9_STARTPC_JNI_NATIVE)) {
+					bindCriticalNative(currentThread, nativeMethod, nativeLibrary, longJNI, shortJNI);
+				}
 				return J9_NATIVE_METHOD_BIND_SUCCESS;
 			} else if (J9_NATIVE_METHOD_BIND_OUT_OF_MEMORY == rc) {
 				Trc_VM_bindNative_NativeLibrary_OOM(currentThread, nativeMethod, nativeLibrary, longJNI, shortJNI, bindJNINative);
@@ -1025,6 +1061,7 @@ bindNative(J9VMThread *currentThread, J9Method *nativeMethod, char *longJNI, cha
 	UDATA rc = lookupNativeAddress(currentThread, nativeMethod, NULL, longJNI, shortJNI, argCount, bindJNINative);
 	if (J9_NATIVE_METHOD_IS_BOUND(nativeMethod)) {
 		Trc_VM_bindNative_NullNativeLibrary_Success(currentThread, nativeMethod, longJNI, shortJNI, bindJNINative);
+		bindCriticalNative(currentThread, nativeMethod, NULL, longJNI, shortJNI);
 		return J9_NATIVE_METHOD_BIND_SUCCESS;
 	} else if (J9_NATIVE_METHOD_BIND_OUT_OF_MEMORY == rc) {
 		Trc_VM_bindNative_NullNativeLibrary_OOM(currentThread, nativeMethod, longJNI, shortJNI, bindJNINative);
@@ -1191,6 +1228,151 @@ lookupNativeAddress(J9VMThread *currentThread, J9Method *nativeMethod, J9NativeL
 	return J9_NATIVE_METHOD_BIND_FAIL;
 }
 
+/**
+ * Look up the critical entrypoint of a static JNI native whose arguments and return
+ * value are all primitives.  A critical native is named like the JNI native with the
+ * "Java_" prefix replaced by "JavaCritical_", and receives neither the JNIEnv nor the
+ * jclass, only the primitive arguments.  It is searched for (short then long name)
+ * where the JNI native was found: in \c nativeLibrary, or through ClassLoader.findNative()
+ * if \c nativeLibrary is NULL.  The address found is recorded in the class loader, so
+ * that the JIT can find it without running java code, see lookupCriticalNativeAddress().
+ *
+ * Critical natives run with VM access held, so they must be short, must not block and
+ * must not call back into the VM.
+ *
+ * \param currentThread
+ * \param nativeMethod The JNI native method, which has just been bound.
+ * \param nativeLibrary The library the JNI native was found in, NULL if it was found by ClassLoader.findNative().
+ * \param longJNI The long mangled JNI name.
+ * \param shortJNI The short mangled JNI name.
+ * \warning This function may run java code if \c nativeLibrary is NULL.
+ */
+static void
+bindCriticalNative(J9VMThread *currentThread, J9Method *nativeMethod, J9NativeLibrary *nativeLibrary, char *longJNI, char *shortJNI)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9Class *ramClass = J9_CLASS_FROM_METHOD(nativeMethod);
+	J9ClassLoader *classLoader = ramClass->classLoader;
+	J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(nativeMethod);
+	char argSignature[260];  /* max args is 256 + JNIEnv + jobject/jclass + return type + '\0' */
+	char criticalSignature[258];  /* max args is 256 + return type + '\0' */
+	UDATA longJNILength = strlen(longJNI);
+	char *criticalName = NULL;
+	void *criticalAddress = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (J9_ARE_NO_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_CRITICAL_JNI_NATIVES)
+		|| J9_ARE_NO_BITS_SET(romMethod->modifiers, J9AccStatic)
+		/* Anonymous classes are unloaded without their class loader, which would leave a stale entry */
+		|| J9_ARE_ANY_BITS_SET(ramClass->classFlags, J9ClassIsAnonymous)
+	) {
+		return;
+	}
+
+	/* Only primitives can be passed without the JNIEnv, references (including arrays) need it */
+	nativeSignature(nativeMethod, argSignature);
+	if ('L' == argSignature[0]) {
+		return;
+	}
+	if (NULL != strchr(argSignature + 3, 'L')) {
+		return;
+	}
+	criticalSignature[0] = argSignature[0];
+	strcpy(criticalSignature + 1, argSignature + 3);
+
+	/* "JavaCritical_" replaces "Java_" */
+	criticalName = (char*)j9mem_allocate_memory(longJNILength + 9, OMRMEM_CATEGORY_VM);
+	if (NULL == criticalName) {
+		return;
+	}
+	for (UDATA i = 0; (i < 2) && (NULL == criticalAddress); ++i) {
+		void *functionAddress = NULL;
+		strcpy(criticalName, "JavaCritical_");
+		strcat(criticalName, ((0 == i) ? shortJNI : longJNI) + 5);
+#if JAVA_SPEC_VERSION >= 15
+		if (NULL == nativeLibrary) {
+			J9MemoryManagerFunctions const * const mmFuncs = vm->memoryManagerFunctions;
+			J9NameAndSignature nas = {0};
+			nas.name = (J9UTF8 *)&j9_findnative_name;
+			nas.signature = (J9UTF8 *)&j9_findnative_sig;
+			internalAcquireVMAccess(currentThread);
+			j9object_t entryName = mmFuncs->j9gc_createJavaLangString(currentThread, (U_8*)criticalName, strlen(criticalName), 0);
+			if (NULL != entryName) {
+				UDATA args[] = { (UDATA) classLoader->classLoaderObject, (UDATA) entryName };
+				runStaticMethod(currentThread, (U_8 *)"java/lang/ClassLoader", &nas, 2, (UDATA *)args);
+				functionAddress = (void *) currentThread->returnValue;
+			}
+			/* The critical entrypoint is optional, so a failed lookup is not reported */
+			if (NULL != currentThread->currentException) {
+				currentThread->currentException = NULL;
+				functionAddress = NULL;
+			}
+			internalReleaseVMAccess(currentThread);
+		} else
+#endif /* JAVA_SPEC_VERSION >= 15 */
+		if (0 != j9sl_lookup_name(nativeLibrary->handle, criticalName, (UDATA*)&functionAddress, criticalSignature)) {
+			functionAddress = NULL;
+		}
+		if (NULL != functionAddress) {
+#if defined(J9VM_NEEDS_JNI_REDIRECTION)
+			/* Critical natives are called directly, there is no trampoline for a misaligned entrypoint */
+			if (0 != ((UDATA)functionAddress & (J9JNIREDIRECT_REQUIRED_ALIGNMENT - 1))) {
+				break;
+			}
+#endif /* J9VM_NEEDS_JNI_REDIRECTION */
+			criticalAddress = functionAddress;
+			Trc_VM_lookupCriticalNativeAddress_found(currentThread, nativeMethod, nativeLibrary, criticalName, criticalAddress);
+		}
+	}
+	j9mem_free_memory(criticalName);
+
+	if (NULL != criticalAddress) {
+		J9CriticalNativeEntry exemplar;
+
+		exemplar.nativeMethod = nativeMethod;
+		exemplar.criticalAddress = criticalAddress;
+		omrthread_monitor_enter(vm->bindNativeMutex);
+		if (NULL == classLoader->criticalNativeHashTable) {
+			classLoader->criticalNativeHashTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), "Critical native table", 0, sizeof(J9CriticalNativeEntry), 0, 0, OMRMEM_CATEGORY_VM, criticalNativeHash, criticalNativeEqual, NULL, NULL);
+		}
+		if (NULL != classLoader->criticalNativeHashTable) {
+			/* If the table entry cannot be added, the native is called through JNI */
+			hashTableAdd(classLoader->criticalNativeHashTable, &exemplar);
+		}
+		omrthread_monitor_exit(vm->bindNativeMutex);
+	}
+}
+
+/**
+ * Find the critical entrypoint recorded when a JNI native was bound, see bindCriticalNative().
+ * This does not run java code, so it can be used by the JIT at compile time.
+ *
+ * \param currentThread
+ * \param nativeMethod The JNI native method.
+ * \return The address of the critical native, NULL if there is none or the method is not eligible.
+ */
+void *
+lookupCriticalNativeAddress(J9VMThread *currentThread, J9Method *nativeMethod)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9ClassLoader *classLoader = J9_CLASS_FROM_METHOD(nativeMethod)->classLoader;
+	void *criticalAddress = NULL;
+
+	omrthread_monitor_enter(vm->bindNativeMutex);
+	if (NULL != classLoader->criticalNativeHashTable) {
+		J9CriticalNativeEntry exemplar;
+		J9CriticalNativeEntry *entry = NULL;
+
+		exemplar.nativeMethod = nativeMethod;
+		entry = (J9CriticalNativeEntry*)hashTableFind(classLoader->criticalNativeHashTable, &exemplar);
+		if (NULL != entry) {
+			criticalAddress = entry->criticalAddress;
+		}
+	}
+	omrthread_monitor_exit(vm->bindNativeMutex);
+	return criticalAddress;
+}
+
 void atomicOrIntoConstantPool(J9JavaVM *vm, J9Method *method, UDATA cpFlags)
 {
 	VM_AtomicSupport::bitOr((UDATA*)&method->constantPool, cpFlags);
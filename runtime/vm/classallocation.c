@@ -422,6 +422,12 @@ freeClassLoader(J9ClassLoader *classLoader, J9JavaVM *javaVM, J9VMThread *vmThre
 		classLoader->packageHashTable = NULL;
 	}
 
+	/* Free the table of JavaCritical_ entrypoints */
+	if (NULL != classLoader->criticalNativeHashTable) {
+		hashTableFree(classLoader->criticalNativeHashTable);
+		classLoader->criticalNativeHashTable = NULL;
+	}
+
 	/* Free the ROM class orphans class table */
 	if (NULL != classLoader->romClassOrphansHashTable) {
 		hashTableFree(classLoader->romClassOrphansHashTable);
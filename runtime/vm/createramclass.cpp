@@ -2898,6 +2898,8 @@ fail:
 			ramClass->module = NULL;
 			ramClass->reservedCounter = 0;
 			ramClass->cancelCounter = 0;
+			ramClass->spinAcquiredCounter = 0;
+			ramClass->spinFailedCounter = 0;
 
 			/* hostClass is exclusively defined only in Unsafe.defineAnonymousClass.
 			 * For all other cases, clazz->hostClass points to itself (clazz).
@@ -1924,8 +1924,27 @@ jniPushFrame(J9VMThread * vmThread, UDATA type, UDATA capacity)
 	if (frame) {
 		frame->type = type;
 		frame->previous = (J9JNIReferenceFrame*)vmThread->jniLocalReferences;
-		frame->references = pool_new( sizeof(UDATA), capacity, sizeof(UDATA), POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(javaVM->portLibrary));
+		frame->capacity = capacity;
+		frame->references = NULL;
+		/* Reuse a reference pool released by a popped frame rather than allocating a new one for every frame.
+		 * Only a pool created for the same capacity is taken, so that the frame capacity seen by -Xcheck:jni
+		 * is the one a new pool would have.
+		 */
+		for (UDATA i = 0; i < vmThread->jniReferencePoolCacheCount; i++) {
+			if (capacity == vmThread->jniReferencePoolCacheCapacity[i]) {
+				UDATA last = vmThread->jniReferencePoolCacheCount - 1;
+				frame->references = vmThread->jniReferencePoolCache[i];
+				vmThread->jniReferencePoolCache[i] = vmThread->jniReferencePoolCache[last];
+				vmThread->jniReferencePoolCacheCapacity[i] = vmThread->jniReferencePoolCacheCapacity[last];
+				vmThread->jniReferencePoolCacheCount = last;
+				break;
+			}
+		}
+		if (NULL == frame->references) {
+			frame->references = pool_new( sizeof(UDATA), capacity, sizeof(UDATA), POOL_NO_ZERO, J9_GET_CALLSITE(), J9MEM_CATEGORY_JNI, POOL_FOR_PORT(javaVM->portLibrary));
+		}
 		if (frame->references) {
+			frame->poolCapacity = pool_capacity((J9Pool*)frame->references);
 			vmThread->jniLocalReferences = (UDATA*)frame;
 			result = 0;
 		} else {
@@ -1958,8 +1977,22 @@ jniPopFrame(J9VMThread * vmThread, UDATA type)
 	while (frame != NULL) {
 		UDATA currentFrameType = frame->type;
 		J9JNIReferenceFrame* previousFrame = frame->previous;
+		J9Pool *references = (J9Pool*)frame->references;
 
-		pool_kill((J9Pool*)frame->references);
+		/* Keep a few small reference pools for the next frames pushed by this thread. A pool which
+		 * grew while the frame was in use no longer looks like a new pool of its capacity, so it is freed.
+		 */
+		if ((vmThread->jniReferencePoolCacheCount < JNIFRAME_POOL_CACHE_SIZE)
+			&& (frame->capacity <= JNIFRAME_POOL_CACHE_MAX_CAPACITY)
+			&& (pool_capacity(references) == frame->poolCapacity)
+		) {
+			pool_clear(references);
+			vmThread->jniReferencePoolCache[vmThread->jniReferencePoolCacheCount] = references;
+			vmThread->jniReferencePoolCacheCapacity[vmThread->jniReferencePoolCacheCount] = frame->capacity;
+			vmThread->jniReferencePoolCacheCount += 1;
+		} else {
+			pool_kill(references);
+		}
 		pool_removeElement(vmThread->jniReferenceFrames, frame);
 
 		frame = previousFrame;
@@ -206,6 +206,10 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 		print_verbose_stackUsage(vmThread, FALSE);
 	}
 #endif
+
+	if ((0 != vmThread->stackWalkMapsDecoded) || (0 != vmThread->stackWalkMapsCacheHits)) {
+		Trc_VM_deallocateVMThread_stackWalkMaps(vmThread, vmThread->stackWalkMapsDecoded, vmThread->stackWalkMapsCacheHits);
+	}
 	
 	/* vm->memoryManagerFunctions will be NULL if we failed to load the gc dll */
 	if (NULL != vm->memoryManagerFunctions) {
@@ -247,6 +251,10 @@ deallocateVMThread(J9VMThread * vmThread, UDATA decrementZombieCount, UDATA send
 	if (vmThread->jniReferenceFrames) {
 		pool_kill(vmThread->jniReferenceFrames);
 	}
+	while (0 != vmThread->jniReferencePoolCacheCount) {
+		vmThread->jniReferencePoolCacheCount -= 1;
+		pool_kill(vmThread->jniReferencePoolCache[vmThread->jniReferencePoolCacheCount]);
+	}
 
 	if (NULL != vmThread->monitorEnterRecordPool) {
 		pool_kill(vmThread->monitorEnterRecordPool);
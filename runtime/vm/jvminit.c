@@ -667,6 +667,8 @@ freeJavaVM(J9JavaVM * vm)
 		while (NULL != clazz) {
 			j9mem_free_memory(clazz->jniIDs);
 			clazz->jniIDs = NULL;
+			j9mem_free_memory(clazz->methodLookupIndex);
+			clazz->methodLookupIndex = NULL;
 			clazz = allClassesNextDo(&classWalkState);
 		}
 		allClassesEndDo(&classWalkState);
@@ -1443,6 +1445,12 @@ initializeClassPathEntry (J9JavaVM * javaVM, J9ClassPathEntry *cpEntry)
 				/* Save the zipFile */
 				cpEntry->extraInfo = zipFile;
 				cpEntry->type = CPE_TYPE_JAR;
+				if (J9_ARE_ANY_BITS_SET(cpEntry->flags, CPE_FLAG_BOOTSTRAP)
+					&& (NULL != javaVM->dynamicLoadBuffers)
+					&& (NULL != javaVM->dynamicLoadBuffers->prebuildROMClassesFunction)
+				) {
+					javaVM->dynamicLoadBuffers->prebuildROMClassesFunction(javaVM, cpEntry);
+				}
 				return CPE_TYPE_JAR;
 			} else {
 				Trc_VM_initializeClassPathEntry_loadZipFailed(cpEntry->pathLength, cpEntry->path, rc);
@@ -2664,6 +2672,9 @@ IDATA VMInitStages(J9JavaVM *vm, IDATA stage, void* reserved) {
 			break;
 
 		case VM_INITIALIZATION_COMPLETE:
+			if (0 != initializeMonitorDeflation(vm)) {
+				goto _error;
+			}
 			if ((NULL != vm->jitConfig)
 				&& (NULL != vm->jitConfig->samplerThread)
 				&& (0 != vm->vmRuntimeStateListener.minIdleWaitTime)
@@ -3616,6 +3627,16 @@ processVMArgsFromFirstToLast(J9JavaVM * vm)
 		}
 	}
 
+	{
+		IDATA enableCriticalNatives = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXENABLECRITICALJNINATIVES, NULL);
+		IDATA disableCriticalNatives = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXDISABLECRITICALJNINATIVES, NULL);
+		if (enableCriticalNatives > disableCriticalNatives) {
+			vm->extendedRuntimeFlags2 |= J9_EXTENDED_RUNTIME2_CRITICAL_JNI_NATIVES;
+		} else if (enableCriticalNatives < disableCriticalNatives) {
+			vm->extendedRuntimeFlags2 &= ~(UDATA)J9_EXTENDED_RUNTIME2_CRITICAL_JNI_NATIVES;
+		}
+	}
+
 #if defined(J9VM_ZOS_3164_INTEROPERABILITY)
 	{
 		IDATA enable3164Interop = FIND_AND_CONSUME_ARG(EXACT_MATCH, VMOPT_XXENABLE3164INTEROPERABILITY, NULL);
@@ -4086,6 +4107,12 @@ threadInitStages(J9JavaVM* vm, IDATA stage, void* reserved)
 		case HEAP_STRUCTURES_INITIALIZED :
 			break;
 		case ALL_VM_ARGS_CONSUMED :
+			if (0 != vm->thrParkLatencyHistogram) {
+				J9HookInterface **vmHooks = vm->internalVMFunctions->getVMHookInterface(vm);
+				if (0 != (*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_VM_SHUTTING_DOWN, reportParkLatencyHistograms, OMR_GET_CALLSITE(), NULL)) {
+					goto _error;
+				}
+			}
 			break;
 		case BYTECODE_TABLE_SET :
 			break;
@@ -7429,6 +7456,9 @@ freeClassNativeMemory(J9HookInterface** hook, UDATA eventNum, void* eventData, v
 	j9mem_free_memory(clazz->jniIDs);
 	clazz->jniIDs = NULL;
 
+	j9mem_free_memory(clazz->methodLookupIndex);
+	clazz->methodLookupIndex = NULL;
+
 	/* If the class is an interface, free the HCR method ordering table */
 	if (J9ROMCLASS_IS_INTERFACE(clazz->romClass)) {
 		j9mem_free_memory(J9INTERFACECLASS_METHODORDERING(clazz));
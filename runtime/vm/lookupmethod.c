@@ -35,6 +35,8 @@
 #define APPEND_SIG "(Ljava/lang/StringBuilder;)Ljava/lang/StringBuilder;"
 #define NEW_SIG "(Ljava/lang/CharSequence;)Ljava/lang/StringBuilder;"
 #define DEFAULT_INTERFACE_RESOLVE_ARRAY_SIZE	10
+/* classes with at least this many methods get a method lookup index */
+#define METHOD_LOOKUP_INDEX_THRESHOLD 32
 
 /**
  * Holds information about interface method resolution:
@@ -52,7 +54,9 @@ typedef struct J9InterfaceResolveData {
 static char *
 defaultMethodConflictExceptionMessage(J9VMThread *currentThread, J9Class *targetClass, UDATA nameLength, U_8 *name, UDATA sigLength, U_8 *sig, J9Method **methods, UDATA methodsLength);
 static J9Method *
-searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch);
+searchClassForMethodCommon(J9JavaVM *vm, J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch);
+static J9MethodLookupIndex *
+buildMethodLookupIndex(J9JavaVM *vm, J9Class *clazz);
 static J9Method* javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9ROMNameAndSignature *nameAndSig, J9Class *senderClass, UDATA lookupOptions, J9InterfaceResolveData *data);
 static char* getModuleNameUTF(J9VMThread *currentThread, j9object_t moduleObject, char *buffer, UDATA bufferLength);
 
@@ -71,13 +75,67 @@ static char* getModuleNameUTF(J9VMThread *currentThread, j9object_t moduleObject
 J9Method *
 searchClassForMethod(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength)
 {
-	return searchClassForMethodCommon(clazz, name, nameLength,sig, sigLength, FALSE);
+	return searchClassForMethodCommon(NULL, clazz, name, nameLength,sig, sigLength, FALSE);
+}
+
+/**
+ * Build the method lookup index of a class and publish it in the class.
+ * The index hashes the method names only, so that it also serves partial signature lookups.
+ * Methods are inserted in ramMethods order using linear probing, so the first match found
+ * when probing is also the first match a linear search of ramMethods would find.
+ *
+ * @param vm[in] the J9JavaVM
+ * @param clazz[in] the class to index
+ *
+ * @returns the index of the class, or NULL if it could not be allocated
+ */
+static J9MethodLookupIndex *
+buildMethodLookupIndex(J9JavaVM *vm, J9Class *clazz)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9ROMClass *romClass = clazz->romClass;
+	U_32 romMethodCount = romClass->romMethodCount;
+	UDATA slotCount = 1;
+	J9MethodLookupIndex *index = NULL;
+
+	/* keep the load factor at or below 1/2 */
+	while (slotCount < ((UDATA)romMethodCount * 2)) {
+		slotCount <<= 1;
+	}
+	index = (J9MethodLookupIndex *)j9mem_allocate_memory(sizeof(J9MethodLookupIndex) + (slotCount * sizeof(U_32)), J9MEM_CATEGORY_CLASSES);
+	if (NULL != index) {
+		U_32 *slots = J9METHODLOOKUPINDEX_SLOTS(index);
+		UDATA mask = slotCount - 1;
+		U_32 i = 0;
+
+		memset(slots, 0, slotCount * sizeof(U_32));
+		index->romClass = romClass;
+		index->slotCount = slotCount;
+		for (i = 0; i < romMethodCount; i++) {
+			J9UTF8 *nameUTF = J9ROMMETHOD_NAME(J9_ROM_METHOD_FROM_RAM_METHOD(&(clazz->ramMethods[i])));
+			UDATA slot = computeHashForUTF8(J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF)) & mask;
+			while (0 != slots[slot]) {
+				slot = (slot + 1) & mask;
+			}
+			slots[slot] = i + 1;
+		}
+		Trc_VM_searchClass_methodLookupIndexBuilt(clazz, romMethodCount, slotCount);
+
+		/* another thread may have won the race to publish an index */
+		issueWriteBarrier();
+		if (0 != compareAndSwapUDATA((uintptr_t *)&clazz->methodLookupIndex, 0, (uintptr_t)index)) {
+			j9mem_free_memory(index);
+			index = clazz->methodLookupIndex;
+		}
+	}
+	return index;
 }
 
 /**
  * Search method in target class
  * Note: this method is also used for searching enclosing methods to skip validation required by javaLookupMethod.
  *
+ * @param vm[in] the J9JavaVM, or NULL if the method lookup index of the class must not be built
  * @param clazz[in] the class or interface to start the search
  * @param name[in] the name of the method
  * @param nameLength[in] the length of the method name
@@ -88,7 +146,7 @@ searchClassForMethod(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, U
  * @returns the method (if found) or NULL otherwise
  */
 static J9Method *
-searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch)
+searchClassForMethodCommon(J9JavaVM *vm, J9Class * clazz, U_8 * name, UDATA nameLength, U_8 * sig, UDATA sigLength, BOOLEAN partialMatch)
 {
 	J9ROMClass *romClass = clazz->romClass;
 	U_32 romMethodCount = romClass->romMethodCount;
@@ -96,7 +154,41 @@ searchClassForMethodCommon(J9Class * clazz, U_8 * name, UDATA nameLength, U_8 *
 
 	if (romMethodCount != 0) {
 		J9Method * methods = clazz->ramMethods;
-		if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
+		J9MethodLookupIndex *index = NULL;
+
+		if ((romMethodCount >= METHOD_LOOKUP_INDEX_THRESHOLD) && J9_ARE_NO_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
+			index = clazz->methodLookupIndex;
+			if ((NULL == index) && (NULL != vm)) {
+				index = buildMethodLookupIndex(vm, clazz);
+			}
+			/* an index built before the class was redefined can not be used */
+			if ((NULL != index) && (index->romClass != romClass)) {
+				index = NULL;
+			}
+		}
+
+		if (NULL != index) {
+			U_32 *slots = J9METHODLOOKUPINDEX_SLOTS(index);
+			UDATA mask = index->slotCount - 1;
+			UDATA slot = computeHashForUTF8(name, nameLength) & mask;
+
+			Trc_VM_searchClass_useMethodLookupIndex(methods);
+
+			while (0 != slots[slot]) {
+				J9Method * method = &(methods[slots[slot] - 1]);
+				J9ROMMethod * romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(method);
+				J9UTF8 * nameUTF = J9ROMMETHOD_NAME(romMethod);
+				J9UTF8 * sigUTF = J9ROMMETHOD_SIGNATURE(romMethod);
+				IDATA result = partialMatch ?
+						compareMethodNameAndPartialSignature(name, (U_16) nameLength, sig, (U_16) sigLength, J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF))
+						: compareMethodNameAndSignature(name, (U_16) nameLength, sig, (U_16) sigLength, J9UTF8_DATA(nameUTF), J9UTF8_LENGTH(nameUTF), J9UTF8_DATA(sigUTF), J9UTF8_LENGTH(sigUTF));
+				if (0 == result) {
+					searchResult = method;
+					break;
+				}
+				slot = (slot + 1) & mask;
+			}
+		} else if (J9_ARE_ALL_BITS_SET(romClass->extraModifiers, J9AccClassUseBisectionSearch)) {
 			IDATA startIndex = 0;
 			IDATA endIndex = (romMethodCount - 1);
 			IDATA midIndex = endIndex/2;
@@ -339,7 +431,7 @@ javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9R
 	while (iTable != NULL) {
 		J9Class * interfaceClass = iTable->interfaceClass;
 		if (interfaceClass == targetClass) {
-			J9Method * foundMethod = searchClassForMethodCommon(interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+			J9Method * foundMethod = searchClassForMethodCommon(currentThread->javaVM, interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 			if (NULL != foundMethod) {
 				/* As per spec, prevent super-interface private or static methods from being processed */
 				if (J9_ARE_NO_BITS_SET(J9_ROM_METHOD_FROM_RAM_METHOD(foundMethod)->modifiers, J9AccPrivate | J9AccStatic)) {
@@ -365,7 +457,7 @@ javaResolveInterfaceMethods(J9VMThread *currentThread, J9Class *targetClass, J9R
 			continue;
 		}
 
-		foundMethod = searchClassForMethodCommon(interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+		foundMethod = searchClassForMethodCommon(currentThread->javaVM, interfaceClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 
 		/* As per spec, prevent super-interface private or static methods from being processed */
 		if (NULL != foundMethod) {
@@ -697,7 +789,7 @@ retry:
 		/* Search for a matching method in the target class and its superclasses. */
 	
 		while (lookupClass != NULL) {
-			J9Method * foundMethod = searchClassForMethodCommon(lookupClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
+			J9Method * foundMethod = searchClassForMethodCommon(currentThread->javaVM, lookupClass, name, nameLength, sig, sigLength, J9_ARE_ANY_BITS_SET(lookupOptions, J9_LOOK_PARTIAL_SIGNATURE));
 
 			if (foundMethod != NULL) {
 				resultMethod = processMethod(currentThread, lookupOptions, foundMethod, lookupClass, &exception, &exceptionClass, &errorType, nameAndSig, senderClass, targetClass);
@@ -24,6 +24,7 @@
 #include "j9accessbarrier.h"
 #include "j9protos.h"
 #include "mmhook.h"
+#include "mmomrhook.h"
 #include "j9consts.h"
 #include "ut_j9vm.h"
 #include "vm_api.h"
@@ -47,10 +48,17 @@ static UDATA hits, misses;
 
 #define J9_OBJECT_MONITOR_LOOKUP_SLOT(object,vm) ( (((UDATA)object) >> vm->omrVM->_objectAlignmentShift) & (J9VMTHREAD_OBJECT_MONITOR_CACHE_SIZE-1))
 
+typedef struct J9MonitorDeflationState {
+	J9VMThread *vmThread;
+	UDATA deflatedCount;
+} J9MonitorDeflationState;
+
+static UDATA deflateIdleObjectMonitorDo(void *entry, void *userData);
 static UDATA hashMonitorCompare (void *leftKey, void *rightKey, void *userData);
 static UDATA hashMonitorDestroyDo (void *entry, void *opaque);
 static UDATA hashMonitorHash (void *key, void *userData);
 static J9HashTable* createMonitorTable(J9JavaVM *vm, char *tableName);
+static void monitorTableGlobalGCEndHook(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData);
 
 
 static UDATA
@@ -132,8 +140,11 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 
-	if (omrthread_monitor_init_with_name(&vm->monitorTableMutex, 0, "VM monitor table")) {
-		return -1;
+	/* Each table has its own mutex, so there must be enough tables to keep threads inflating
+	 * distinct monitors from contending on the same mutex, even with few GC threads.
+	 */
+	if (tableCount < J9VM_MONITOR_TABLE_MIN_COUNT) {
+		tableCount = J9VM_MONITOR_TABLE_MIN_COUNT;
 	}
 
 	vm->monitorTableListPool = pool_new(sizeof(J9MonitorTableListEntry), 0, 0, 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(vm->portLibrary));
@@ -146,11 +157,23 @@ initializeMonitorTable(J9JavaVM* vm)
 		return -1;
 	}
 	memset(vm->monitorTables, 0, sizeof(J9HashTable *) * tableCount);
-	
+
+	vm->monitorTableMutexes = (omrthread_monitor_t *)j9mem_allocate_memory(sizeof(omrthread_monitor_t) * tableCount, OMRMEM_CATEGORY_VM);
+	if (NULL == vm->monitorTableMutexes) {
+		return -1;
+	}
+	memset(vm->monitorTableMutexes, 0, sizeof(omrthread_monitor_t) * tableCount);
+
+	/* Set the count now so that destroyMonitorTable frees a partially initialized table set */
+	vm->monitorTableCount = tableCount;
 	vm->monitorTableList = NULL;
 
 	for (tableIndex = 0; tableIndex < tableCount; tableIndex++) {
-		J9HashTable *table = createMonitorTable(vm, J9_GET_CALLSITE());
+		J9HashTable *table = NULL;
+		if (omrthread_monitor_init_with_name(&vm->monitorTableMutexes[tableIndex], 0, "VM monitor table")) {
+			return -1;
+		}
+		table = createMonitorTable(vm, J9_GET_CALLSITE());
 		if (NULL == table) {
 			return -1;
 		}
@@ -169,8 +192,6 @@ initializeMonitorTable(J9JavaVM* vm)
 		monitorTableListEntry->monitorTable = table;
 	}
 
-	vm->monitorTableCount = tableCount;
-	
 	return 0;
 }
 
@@ -196,6 +217,19 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTables = NULL;
 	}
 
+	if (NULL != vm->monitorTableMutexes) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+		UDATA tableIndex = 0;
+		for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+			if (NULL != vm->monitorTableMutexes[tableIndex]) {
+				omrthread_monitor_destroy(vm->monitorTableMutexes[tableIndex]);
+			}
+		}
+
+		j9mem_free_memory(vm->monitorTableMutexes);
+		vm->monitorTableMutexes = NULL;
+	}
+
 
 	/* free the monitorTableListPool */
 	if (NULL != vm->monitorTableListPool) {
@@ -203,11 +237,6 @@ destroyMonitorTable(J9JavaVM* vm)
 		vm->monitorTableListPool = NULL;
 	}
 
-	if (NULL != vm->monitorTableMutex) {
-		omrthread_monitor_destroy(vm->monitorTableMutex);
-		vm->monitorTableMutex = NULL;
-	}
-
 	/* Note: destroyMonitorTable is called after the GC hook interface has shut down,
 	 * so we cannot unbook the events.
 	 */
@@ -224,7 +253,7 @@ J9ObjectMonitor *
 monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 {
 	J9JavaVM* vm = vmStruct->javaVM;
-	omrthread_monitor_t mutex = vm->monitorTableMutex;
+	omrthread_monitor_t mutex = NULL;
 	J9ObjectMonitor * objectMonitor = NULL;
 	J9ObjectMonitor key_objectMonitor;
 	J9ThreadAbstractMonitor key_monitor;
@@ -271,7 +300,8 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	key_objectMonitor.hash = objectHashCode(vm, object);
 	index = key_objectMonitor.hash % (U_32)vm->monitorTableCount;
 	monitorTable = vm->monitorTables[index];
-
+	/* Only the table the object hashes to is locked, lookups in the other tables proceed in parallel */
+	mutex = vm->monitorTableMutexes[index];
 
 	omrthread_monitor_enter(mutex);
 
@@ -347,8 +377,115 @@ monitorTableAt(J9VMThread* vmStruct, j9object_t object)
 	return objectMonitor;
 }
 
+UDATA
+initializeMonitorDeflation(J9JavaVM* vm)
+{
+	UDATA rc = 0;
 
+	if (J9VM_DEFLATION_POLICY_NEVER != vm->thrDeflationPolicy) {
+		J9HookInterface **gcOmrHooks = vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
+		if ((*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, monitorTableGlobalGCEndHook, OMR_GET_CALLSITE(), vm)) {
+			rc = -1;
+		}
+	}
 
+	return rc;
+}
+
+/**
+ * Deflate an inflated object monitor which is not in use. The table entry is kept so that the
+ * monitor can be reused without allocation if the object is inflated again.
+ *
+ * @pre all mutator threads are stopped (exclusive VM access)
+ *
+ * @param entry		the J9ObjectMonitor
+ * @param userData	the J9MonitorDeflationState
+ *
+ * @return FALSE (never remove the entry)
+ */
+static UDATA
+deflateIdleObjectMonitorDo(void *entry, void *userData)
+{
+	J9ObjectMonitor *objectMonitor = (J9ObjectMonitor *)entry;
+	J9MonitorDeflationState *state = (J9MonitorDeflationState *)userData;
+	J9VMThread *vmThread = state->vmThread;
+	J9ThreadAbstractMonitor *monitor = (J9ThreadAbstractMonitor *)objectMonitor->monitor;
+
+	/* Threads blocked entering or waiting on the monitor have pinned it, so an unowned and unpinned monitor is idle */
+	if (J9_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_INFLATED)
+		&& (NULL == monitor->owner)
+		&& (0 == monitor->count)
+		&& (0 == monitor->pinCount)
+	) {
+#if defined(OMR_THR_ADAPTIVE_SPIN)
+		/* as in objectMonitorExit, keep monitors with long hold times inflated */
+		if ((NULL != monitor->tracing) && J9_ARE_ANY_BITS_SET(monitor->flags, J9THREAD_MONITOR_DISABLE_SPINNING)) {
+			return FALSE;
+		}
+#endif /* OMR_THR_ADAPTIVE_SPIN */
+#if defined(J9VM_THR_SMART_DEFLATION)
+		/* as in objectMonitorExit, the smart policy keeps monitors which have seen contention inflated */
+		if ((J9VM_DEFLATION_POLICY_SMART == vmThread->javaVM->thrDeflationPolicy) && (0 != objectMonitor->antiDeflationCount)) {
+			return FALSE;
+		}
+#endif /* J9VM_THR_SMART_DEFLATION */
+		{
+			j9object_t object = J9WEAKROOT_OBJECT_LOAD_VM(vmThread->javaVM, &monitor->userData);
+			j9objectmonitor_t *lockEA = NULL;
+			j9objectmonitor_t lock = 0;
+
+			if (LN_HAS_LOCKWORD(vmThread, object)) {
+				lockEA = J9OBJECT_MONITOR_EA(vmThread, object);
+			} else {
+				lockEA = &(objectMonitor->alternateLockword);
+			}
+			lock = J9_LOAD_LOCKWORD(vmThread, lockEA);
+			if (J9_LOCK_IS_INFLATED(lock) && (J9_INFLLOCK_OBJECT_MONITOR(lock) == objectMonitor)) {
+				monitor->flags &= ~J9THREAD_MONITOR_INFLATED;
+				J9_STORE_LOCKWORD(vmThread, lockEA, 0);
+				state->deflatedCount += 1;
+				Trc_VM_objectMonitorDeflatedAtGC(vmThread, object, objectMonitor);
+			}
+		}
+	}
+
+	return FALSE;
+}
+
+/**
+ * Hook "J9HOOK_MM_OMR_GLOBAL_GC_END" callback function.
+ * Deflate the inflated object monitors which are no longer contended, so that the objects go back to using flat locks.
+ */
+static void
+monitorTableGlobalGCEndHook(J9HookInterface **hook, UDATA eventNum, void *eventData, void *userData)
+{
+	MM_GlobalGCEndEvent *event = (MM_GlobalGCEndEvent *)eventData;
+	J9JavaVM *vm = (J9JavaVM *)userData;
+	J9MonitorDeflationState state;
+	UDATA tableIndex = 0;
+
+	/* Monitors are never deflated under the never policy */
+	if (J9VM_DEFLATION_POLICY_NEVER == vm->thrDeflationPolicy) {
+		return;
+	}
+
+	/* Deflation writes lockwords, which is only safe while no mutator thread can be running */
+	if (J9_XACCESS_EXCLUSIVE != vm->exclusiveAccessState) {
+		return;
+	}
+
+	state.vmThread = (J9VMThread *)event->currentThread->_language_vmthread;
+	state.deflatedCount = 0;
+	for (tableIndex = 0; tableIndex < vm->monitorTableCount; tableIndex++) {
+		J9HashTable *table = vm->monitorTables[tableIndex];
+		if (NULL != table) {
+			hashTableForEachDo(table, deflateIdleObjectMonitorDo, &state);
+		}
+	}
+	vm->thrGCDeflatedMonitorCount += state.deflatedCount;
+
+	Trc_VM_monitorTableGlobalGCEnd_deflated(state.vmThread, state.deflatedCount, vm->thrGCDeflatedMonitorCount);
+}
 
 static UDATA
 hashMonitorDestroyDo(void *entry, void *opaque)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1998, 2014 IBM Corp. and others
+ * Copyright (c) 1998, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -29,7 +29,95 @@
 
 #include <string.h>
 
+static UDATA latencyHistogramBucket(I_64 latency);
+static void printLatencyHistogram(J9JavaVM *vm, UDATA *histogram);
+static void recordParkLatency(J9VMThread *vmThread, I_64 parkStartTime);
+static void spinBeforePark(J9VMThread *vmThread, UDATA spinTime);
 
+/**
+ * @param[in] latency a latency in nanoseconds
+ * @return the index of the latency histogram bucket counting the latency
+ */
+static UDATA
+latencyHistogramBucket(I_64 latency)
+{
+	U_64 micros = (latency > 0) ? ((U_64)latency / 1000) : 0;
+	UDATA bucket = 0;
+
+	while ((bucket < (J9_PARK_LATENCY_HISTOGRAM_BUCKETS - 1)) && (micros >= ((U_64)1 << bucket))) {
+		bucket += 1;
+	}
+	return bucket;
+}
+
+/**
+ * Spin for a short time waiting for an unpark, so that a thread which is unparked soon after
+ * parking does not have to block and be woken by the OS. The spin time is bounded by twice
+ * the recent wake-up latency of the thread, and by spinTime.
+ *
+ * The spin is only a hint, omrthread_park() must still be called afterwards: if the thread
+ * was unparked while spinning, the park permit is already available and it returns immediately.
+ *
+ * @param[in] vmThread the current thread, which has released VM access
+ * @param[in] spinTime the maximum spin time in nanoseconds
+ */
+static void
+spinBeforePark(J9VMThread *vmThread, UDATA spinTime)
+{
+	PORT_ACCESS_FROM_VMC(vmThread);
+	I_64 const spinStart = j9time_nano_time();
+	I_64 spinLimit = (I_64)spinTime;
+
+	if ((0 != vmThread->parkWakeLatency) && ((I_64)(vmThread->parkWakeLatency * 2) < spinLimit)) {
+		spinLimit = (I_64)(vmThread->parkWakeLatency * 2);
+	}
+	while (0 == vmThread->parkUnparkTime) {
+		if ((j9time_nano_time() - spinStart) >= spinLimit) {
+			break;
+		}
+		/* give the CPU to the unparking thread if it shares it with this one */
+		omrthread_yield();
+		issueReadBarrier();
+	}
+}
+
+/**
+ * Update the wake-up latency of the current thread after it returned from omrthread_park(),
+ * and the park and unpark latency histograms if -Xthr:parkLatencyHistogram was specified.
+ *
+ * @param[in] vmThread the current thread
+ * @param[in] parkStartTime j9time_nano_time() when the thread started parking
+ */
+static void
+recordParkLatency(J9VMThread *vmThread, I_64 parkStartTime)
+{
+	PORT_ACCESS_FROM_VMC(vmThread);
+	J9JavaVM *vm = vmThread->javaVM;
+	I_64 const now = j9time_nano_time();
+	I_64 const parkLatency = now - parkStartTime;
+	UDATA const unparkTime = vmThread->parkUnparkTime;
+
+	/* moving average over the last few parks, with a weight of 1/8 for the latest one */
+	if (parkLatency > 0) {
+		IDATA const average = (IDATA)vmThread->parkWakeLatency;
+		vmThread->parkWakeLatency = (UDATA)(average + (((IDATA)parkLatency - average) / 8));
+	}
+
+	if (0 != vm->thrParkLatencyHistogram) {
+		addAtomic(&vm->parkLatencyHistogram[latencyHistogramBucket(parkLatency)], 1);
+		if (0 != unparkTime) {
+			/* time from the unpark until the parked thread ran again, computed modulo UDATA */
+			addAtomic(&vm->unparkLatencyHistogram[latencyHistogramBucket((I_64)((UDATA)now - unparkTime))], 1);
+		}
+	}
+
+	/* The unpark, if any, has been consumed by this park. A newer unpark which published its
+	 * time after it was read above has left a permit for the next park, so its time is kept.
+	 */
+	if (0 != unparkTime) {
+		compareAndSwapUDATA((uintptr_t *)&vmThread->parkUnparkTime, (uintptr_t)unparkTime, 0);
+	}
+}
 
 /**
  * @param[in] vmThread the current thread
@@ -83,15 +171,30 @@ threadParkImpl(J9VMThread *vmThread, IDATA timeoutIsEpochRelative, I_64 timeout)
 		TRIGGER_J9HOOK_VM_PARK(vmThread->javaVM->hookInterface, vmThread, millis, nanos);
 		internalReleaseVMAccessSetStatus(vmThread, thrstate);
 
-		while(1){
-			I_64 timeNow;
-			rc = omrthread_park(millis, nanos);
+		{
+			UDATA const spinTime = vmThread->javaVM->thrParkSpinTime;
+			I_64 const parkStartTime = j9time_nano_time();
 
-			if(!(timeoutIsEpochRelative && rc == J9THREAD_TIMED_OUT && ((timeNow=j9time_current_time_millis()) < timeout))){
-				break;
+			/* Spin first unless the recent parks of this thread lasted much longer than the spin, or the timeout is shorter */
+			if ((0 != spinTime)
+				&& (vmThread->parkWakeLatency < spinTime)
+				&& (((0 == millis) && (0 == nanos)) || (0 != millis) || ((UDATA)nanos > spinTime))
+			) {
+				spinBeforePark(vmThread, spinTime);
 			}
-			millis = timeout - timeNow;
-			nanos = 0;
+
+			while(1){
+				I_64 timeNow;
+				rc = omrthread_park(millis, nanos);
+
+				if(!(timeoutIsEpochRelative && rc == J9THREAD_TIMED_OUT && ((timeNow=j9time_current_time_millis()) < timeout))){
+					break;
+				}
+				millis = timeout - timeNow;
+				nanos = 0;
+			}
+
+			recordParkLatency(vmThread, parkStartTime);
 		}
 	
 		internalAcquireVMAccessClearStatus(vmThread, thrstate);
@@ -140,6 +243,16 @@ threadUnparkImpl(J9VMThread* vmThread, j9object_t threadObject)
 	/*Trc_JCL_unpark_Entry(vmThread, otherVmThread);*/
 	if (otherVmThread != NULL){
 		/* in this case the thread is already dead so we don't need to unpark */
+		/* Stop the spin of the parked thread. The time is published before the unpark, so that the
+		 * parked thread cannot return from omrthread_park() and clear it before it has been set,
+		 * which would leave a stale time for its next park. A thread which sees the time before the
+		 * permit is available only blocks in omrthread_park() until the unpark below.
+		 */
+		if ((0 != vmThread->javaVM->thrParkSpinTime) || (0 != vmThread->javaVM->thrParkLatencyHistogram)) {
+			PORT_ACCESS_FROM_VMC(vmThread);
+			otherVmThread->parkUnparkTime = (UDATA)j9time_nano_time() | 1;
+			issueWriteBarrier();
+		}
 		omrthread_unpark(otherVmThread->osThread);
 	}
 	objectMonitorExit(vmThread, threadLock);
@@ -147,3 +260,37 @@ threadUnparkImpl(J9VMThread* vmThread, j9object_t threadObject)
 	/*Trc_JCL_unpark_Exit(vmThread);*/
 }
 
+/**
+ * Print the non-empty buckets of a park or unpark latency histogram.
+ *
+ * @param[in] vm the J9JavaVM
+ * @param[in] histogram the histogram, with J9_PARK_LATENCY_HISTOGRAM_BUCKETS buckets
+ */
+static void
+printLatencyHistogram(J9JavaVM *vm, UDATA *histogram)
+{
+	UDATA bucket = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	for (bucket = 0; bucket < (J9_PARK_LATENCY_HISTOGRAM_BUCKETS - 1); bucket++) {
+		if (0 != histogram[bucket]) {
+			j9tty_err_printf(PORTLIB, "  < %llu: %zu\n", (U_64)1 << bucket, histogram[bucket]);
+		}
+	}
+	if (0 != histogram[bucket]) {
+		j9tty_err_printf(PORTLIB, "  >= %llu: %zu\n", (U_64)1 << (bucket - 1), histogram[bucket]);
+	}
+}
+
+void
+reportParkLatencyHistograms(J9HookInterface **hookInterface, UDATA eventNum, void *eventData, void *userData)
+{
+	J9VMShutdownEvent *event = eventData;
+	J9JavaVM *vm = event->vmThread->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	j9tty_err_printf(PORTLIB, "Park latency histogram (time parked, microseconds):\n");
+	printLatencyHistogram(vm, vm->parkLatencyHistogram);
+	j9tty_err_printf(PORTLIB, "Unpark latency histogram (unpark to wake-up of the parked thread, microseconds):\n");
+	printLatencyHistogram(vm, vm->unparkLatencyHistogram);
+}
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2001, 2020 IBM Corp. and others
+ * Copyright (c) 2001, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -159,10 +159,12 @@ vmizip_openZipFile(VMInterface * vmi, char *filename, VMIZipFile * vmizipFile, I
 			readCacheData = !result;
 		}
 		sharedConfig = vm->sharedClassConfig;
-		/* bootstrap jars are controlled by the J9VM_ZERO_SHAREBOOTZIPCACHE flag */
+		/* bootstrap jars are controlled by the J9VM_ZERO_SHAREBOOTZIPCACHE flag or -Xshareclasses:shareZipCache */
 		if ((0 == result)
 			&& (NULL != sharedConfig)
-			&& ((flags & ZIP_FLAG_BOOTSTRAP) && (vm->zeroOptions & J9VM_ZERO_SHAREBOOTZIPCACHE))
+			&& (flags & ZIP_FLAG_BOOTSTRAP)
+			&& ((vm->zeroOptions & J9VM_ZERO_SHAREBOOTZIPCACHE)
+				|| ((NULL != vm->sharedCacheAPI) && vm->sharedCacheAPI->shareZipCache))
 			&& !zipCache_isCopied(zipFile->cache)
 		) {
 			result = (*((JavaVM *)vm))->GetEnv((JavaVM *)vm, (void **) &env, JNI_VERSION_1_2);
@@ -506,6 +506,7 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 	vm->thrMaxTryEnterYieldsBeforeBlocking = 45;
 	vm->thrNestedSpinning = 1;
 	vm->thrTryEnterNestedSpinning = 1;
+	vm->thrAdaptiveSpinning = 1;
 	vm->thrDeflationPolicy = J9VM_DEFLATION_POLICY_ASAP;
 
 	if (cpus > 1) {
@@ -519,6 +520,7 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 		vm->thrMaxSpins2BeforeBlocking = 32;
 		vm->thrMaxTryEnterSpins1BeforeBlocking = 256;
 		vm->thrMaxTryEnterSpins2BeforeBlocking = 32;
+		vm->thrParkSpinTime = J9_PARK_SPIN_TIME_DEFAULT;
 	} else {
 		/* In ObjectMonitor.cpp:objectMonitorEnterNonBlocking, we converted
 		 * "goto statements" into "three nested for loops". Due to this change,
@@ -731,6 +733,28 @@ threadParseArguments(J9JavaVM *vm, char *optArg)
 			continue;
 		}
 
+		if (try_scan(&scan_start, "parkSpinTime=")) {
+			if (scan_udata(&scan_start, &vm->thrParkSpinTime)) {
+				goto _error;
+			}
+			continue;
+		}
+
+		if (try_scan(&scan_start, "parkLatencyHistogram")) {
+			vm->thrParkLatencyHistogram = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "adaptiveSpinning")) {
+			vm->thrAdaptiveSpinning = 1;
+			continue;
+		}
+
+		if (try_scan(&scan_start, "noAdaptiveSpinning")) {
+			vm->thrAdaptiveSpinning = 0;
+			continue;
+		}
+
 		if (try_scan(&scan_start, "tryEnterNestedSpinning")) {
 			vm->thrTryEnterNestedSpinning = 1;			
 			continue;
@@ -1309,6 +1333,11 @@ dumpThreadingInfo(J9JavaVM* jvm)
 	j9tty_printf(PORTLIB, LEADING_SPACE "tryEnterYield=%zu,\n", jvm->thrMaxTryEnterYieldsBeforeBlocking);
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestedSpinning,\n", (jvm->thrNestedSpinning) ? "n" : "noN");
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sryEnterNestedSpinning,\n", (jvm->thrTryEnterNestedSpinning) ? "t" : "noT");
+	j9tty_printf(PORTLIB, LEADING_SPACE "%sdaptiveSpinning,\n", (jvm->thrAdaptiveSpinning) ? "a" : "noA");
+	j9tty_printf(PORTLIB, LEADING_SPACE "parkSpinTime=%zu,\n", jvm->thrParkSpinTime);
+	if (jvm->thrParkLatencyHistogram) {
+		j9tty_printf(PORTLIB, LEADING_SPACE "parkLatencyHistogram,\n");
+	}
 	j9tty_printf(PORTLIB, LEADING_SPACE "%sestroyMutexOnMonitorFree,\n", 
 		J9_ARE_ALL_BITS_SET(omrthread_lib_get_flags(), J9THREAD_LIB_FLAG_DESTROY_MUTEX_ON_MONITOR_FREE) ? "d" : "noD");
 #if !defined(WIN32) && defined(OMR_NOTIFY_POLICY_CONTROL)
@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2014 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -169,6 +169,15 @@ void
 zipCache_invalidateCache(J9ZipCache * zipCache);
 
 
+/**
+* @brief
+* @param zipCache
+* @return BOOLEAN
+*/
+BOOLEAN
+zipCache_buildIndex(J9ZipCache * zipCache);
+
+
 #endif /* J9VM_OPT_ZIP_SUPPORT */ /* End File Level Build Flags */
 
 
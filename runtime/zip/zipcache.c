@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 1991, 2019 IBM Corp. and others
+ * Copyright (c) 1991, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -45,7 +45,7 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
@@ -53,6 +53,11 @@
 #define OFFSET_MASK	(~ISCLASS_BIT)
 #define	IMPLICIT_ENTRY	(~ISCLASS_BIT)
 
+/* Tags the entryOffset of an index slot which refers to a J9ZipDirEntry */
+#define INDEX_DIR_TAG	((IDATA)1)
+/* Smallest number of slots in an index, the index is kept at most half full */
+#define INDEX_MIN_SLOTS	16
+
 
 void zipCache_freeChunk (J9PortLibrary * portLib, J9ZipChunkHeader *chunk);
 J9ZipDirEntry *zipCache_searchDirListCaseInsensitive (J9ZipDirEntry * dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
@@ -66,6 +71,13 @@ IDATA helper_memicmp (const void *src1, const void *src2, UDATA length);
 J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *orgDirEntry, J9ZipCacheEntry *zce, J9ZipDirEntry *rootEntry);
 void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 void zipCache_walkCache(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static UDATA zipCache_indexSlotCount (UDATA entryCount);
+static UDATA zipCache_hashName (IDATA dirOffset, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static void zipCache_setIndex (J9ZipCacheEntry *zce, J9ZipIndexSlot *slots, UDATA slotCount);
+static void zipCache_indexInsert (J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, UDATA *entry, const char *namePtr, UDATA nameSize, BOOLEAN isClass, BOOLEAN isDir);
+static void zipCache_indexDirEntry (J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static UDATA *zipCache_indexFind (J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass, BOOLEAN isDir);
+static void zipCache_freeIndex (J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -215,8 +227,8 @@ const char *zipCache_uniqueId(J9ZipCache * zipCache) {
 
 #if defined(J9VM_OPT_SHARED_CLASSES)
 /** 
- * Returns the size required for the zip cache data, in bytes. If the
- * cache data has been copied, zero is returned.
+ * Returns the size required for the zip cache data, including its lookup
+ * index, in bytes. If the cache data has been copied, zero is returned.
  *
  * @param[in] zipCache the zip cache
  *
@@ -236,6 +248,9 @@ UDATA zipCache_cacheSize(J9ZipCache * zipCache) {
 		/* If the zip cache has already been copied, the currentChunk will be NULL and
 		 * the sizeRequired will be zero. */
 		U_8 *zipFileName = ZIP_SRP_GET(zce->zipFileName, U_8 *);
+		if (0 != zce->entryCount) {
+			sizeRequired += zipCache_indexSlotCount(zce->entryCount) * sizeof(J9ZipIndexSlot);
+		}
 		/*If zipFileName is Null, then we should not add the length of zipFileName into sizerequired*/
 		if (NULL == zipFileName){
 			return sizeRequired;
@@ -358,6 +373,16 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 		return FALSE;
 	}
 
+	/* The index follows the entries, so the copy is looked up by hash in every JVM sharing it */
+	if (0 != zce->entryCount) {
+		UDATA slotCount = zipCache_indexSlotCount(zce->entryCount);
+		char *unused = NULL;
+		J9ZipIndexSlot *slots = (J9ZipIndexSlot *)zipCache_reserveEntry(zce, chunk, slotCount * sizeof(J9ZipIndexSlot), 0, &unused);
+		if (NULL != slots) {
+			zipCache_setIndex(zce, slots, slotCount);
+		}
+	}
+
 	/* Null the currentChunk so it can't be free'd */
 	ZIP_SRP_SET_TO_NULL(zce->currentChunk);
 
@@ -570,6 +595,9 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 		((elementOffset & OFFSET_MASK) == IMPLICIT_ENTRY))
 		return FALSE;
 
+	/* The index does not grow, lookups walk the lists until zipCache_buildIndex() is called again */
+	zipCache_freeIndex(portLib, zce);
+
 	dirEntry = &zce->root;
 
 	curName = elementName;
@@ -698,7 +726,11 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			if (zce->index) {
+				fileEntry = (J9ZipFileEntry *)zipCache_indexFind(zce, dirEntry, curName, curSize, isClass, FALSE);
+			} else {
+				fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			}
 			if (fileEntry) {
 				return fileEntry->zipFileOffset & OFFSET_MASK;
 			}
@@ -710,7 +742,11 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 		/* If we got here, we're looking at a prefix which ends with '/', or searchDirList is TRUE */
 		/* Treat that prefix as a subdirectory.  It will exist if elementName was added before. */
 
-		dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+		if (zce->index) {
+			dirEntry = (J9ZipDirEntry *)zipCache_indexFind(zce, dirEntry, curName, curSize, isClass, TRUE);
+		} else {
+			dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+		}
 		if (!dirEntry)
 			return NOT_FOUND;
 		curName += prefixSize;
@@ -718,6 +754,42 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 	}
 }
 
+/**
+ * Builds the hashed index used by zipCache_findElement() to look up each
+ * name component without walking the directory and file lists. Called
+ * once the cache has been populated. A cache copied by zipCache_copy()
+ * already has an index. If the index cannot be allocated, lookups
+ * walk the lists.
+ *
+ * @param[in] zipCache the zip cache
+ *
+ * @return TRUE if the cache has an index
+ */
+BOOLEAN
+zipCache_buildIndex(J9ZipCache * zipCache)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+	J9ZipCacheEntry *zce = zci->entry;
+	J9ZipIndexSlot *slots;
+	UDATA slotCount;
+	PORT_ACCESS_FROM_PORT(zipCache->portLib);
+
+	if (zce->index) {
+		return TRUE;
+	}
+	if (0 == zce->entryCount) {
+		return FALSE;
+	}
+	slotCount = zipCache_indexSlotCount(zce->entryCount);
+	slots = j9mem_allocate_memory(slotCount * sizeof(J9ZipIndexSlot), J9MEM_CATEGORY_VM_JCL);
+	if (!slots) {
+		return FALSE;
+	}
+	memset(slots, 0, slotCount * sizeof(J9ZipIndexSlot));
+	zipCache_setIndex(zce, slots, slotCount);
+	return TRUE;
+}
+
 /** 
  * Frees the zip cache chunks
  *
@@ -742,6 +814,8 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 		return;
 	}
 
+	zipCache_freeIndex(portLib, zce);
+
 	chunk2 = (J9ZipChunkHeader *)(((U_8 *)zce) - sizeof(J9ZipChunkHeader));
 	if (((UDATA)(zipFileName - (U_8 *)chunk2)) >= ACTUAL_CHUNK_SIZE)   {
 		/* HACK!!  zce->info.zipFileName points outside the first chunk, therefore it was allocated
@@ -810,6 +884,7 @@ J9ZipDirEntry *zipCache_addToDirList(J9PortLibrary * portLib, J9ZipCacheEntry *z
 	ZIP_SRP_SET(entry->next, ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *));
 	ZIP_SRP_SET(dirEntry->dirList, entry);
 	entry->zipFileOffset = IMPLICIT_ENTRY | (isClass ? ISCLASS_BIT : 0);
+	zce->entryCount++;
 	memcpy(name, namePtr, nameSize);
 	/* name[nameSize] is already zero (NUL) */
 	return entry;
@@ -864,6 +939,7 @@ haveEntry:
 	memcpy(name, namePtr, nameSize);
 	entry->nameLength = nameSize;
 	entry->zipFileOffset = elementOffset | (isClass ? ISCLASS_BIT : 0);
+	zce->entryCount++;
 	return entry;
 }
 
@@ -1268,4 +1344,151 @@ IDATA helper_memicmp(const void *src1, const void *src2, UDATA length)
 }
 
 
+
+/* Returns the number of index slots for entryCount elements, a power of two at least twice entryCount. */
+
+static UDATA
+zipCache_indexSlotCount(UDATA entryCount)
+{
+	UDATA slotCount = INDEX_MIN_SLOTS;
+
+	while (slotCount < (entryCount * 2)) {
+		slotCount <<= 1;
+	}
+	return slotCount;
+}
+
+
+
+/* Hashes the name of an element of the directory at dirOffset from the J9ZipCacheEntry. */
+
+static UDATA
+zipCache_hashName(IDATA dirOffset, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	UDATA hash = (UDATA)dirOffset ^ (isClass ? 1 : 0);
+	UDATA i;
+
+	for (i = 0; i < nameSize; i++) {
+		hash = (hash * 31) + (U_8)namePtr[i];
+	}
+	return hash ^ (hash >> 16);
+}
+
+
+
+/* Installs the zeroed slots as the index of zce and adds every element of the cache to it. */
+/* Slots are addressed relative to zce, so an index copied into shared memory is valid in every JVM mapping it. */
+
+static void
+zipCache_setIndex(J9ZipCacheEntry *zce, J9ZipIndexSlot *slots, UDATA slotCount)
+{
+	ZIP_SRP_SET(zce->index, slots);
+	zce->indexSlotCount = slotCount;
+	zipCache_indexDirEntry(zce, &zce->root);
+}
+
+
+
+/* Adds the files and subdirectories of dirEntry, recursively, to the index of zce. */
+
+static void
+zipCache_indexDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry)
+{
+	J9ZipFileRecord *record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *);
+	J9ZipDirEntry *subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *);
+	UDATA i;
+
+	while (record) {
+		J9ZipFileEntry *fileEntry = record->entry;
+		for (i = 0; i < record->entryCount; i++) {
+			zipCache_indexInsert(zce, dirEntry, (UDATA *)fileEntry, J9ZIPFILEENTRY_NAME(fileEntry), fileEntry->nameLength,
+				(fileEntry->zipFileOffset & ISCLASS_BIT) != 0, FALSE);
+			fileEntry = J9ZIPFILEENTRY_NEXT(fileEntry);
+		}
+		record = ZIP_SRP_GET(record->next, J9ZipFileRecord *);
+	}
+	while (subDir) {
+		const char *name = J9ZIPDIRENTRY_NAME(subDir);
+		zipCache_indexInsert(zce, dirEntry, (UDATA *)subDir, name, strlen(name), (subDir->zipFileOffset & ISCLASS_BIT) != 0, TRUE);
+		zipCache_indexDirEntry(zce, subDir);
+		subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *);
+	}
+}
+
+
+
+/* Adds a file or directory entry of dirEntry to the index of zce. The index always has a free slot. */
+
+static void
+zipCache_indexInsert(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, UDATA *entry, const char *namePtr, UDATA nameSize, BOOLEAN isClass, BOOLEAN isDir)
+{
+	J9ZipIndexSlot *slots = ZIP_SRP_GET(zce->index, J9ZipIndexSlot *);
+	UDATA mask = zce->indexSlotCount - 1;
+	IDATA dirOffset = (IDATA)((U_8 *)dirEntry - (U_8 *)zce);
+	UDATA i = zipCache_hashName(dirOffset, namePtr, nameSize, isClass) & mask;
+
+	while (0 != slots[i].entryOffset) {
+		i = (i + 1) & mask;
+	}
+	slots[i].dirOffset = dirOffset;
+	slots[i].entryOffset = (IDATA)((U_8 *)entry - (U_8 *)zce) | (isDir ? INDEX_DIR_TAG : 0);
+}
+
+
+
+/* Searches the index of zce for the file (or directory, if isDir) of dirEntry named */
+/* namePtr[0..nameSize-1] with the specified isClass value. */
+
+static UDATA *
+zipCache_indexFind(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass, BOOLEAN isDir)
+{
+	J9ZipIndexSlot *slots = ZIP_SRP_GET(zce->index, J9ZipIndexSlot *);
+	UDATA mask = zce->indexSlotCount - 1;
+	IDATA dirOffset = (IDATA)((U_8 *)dirEntry - (U_8 *)zce);
+	IDATA tag = isDir ? INDEX_DIR_TAG : 0;
+	UDATA i = zipCache_hashName(dirOffset, namePtr, nameSize, isClass) & mask;
+
+	while (0 != slots[i].entryOffset) {
+		J9ZipIndexSlot *slot = &slots[i];
+		if ((slot->dirOffset == dirOffset) && ((slot->entryOffset & INDEX_DIR_TAG) == tag)) {
+			U_8 *entry = (U_8 *)zce + (slot->entryOffset & ~INDEX_DIR_TAG);
+			if (isDir) {
+				J9ZipDirEntry *dir = (J9ZipDirEntry *)entry;
+				const char *name = J9ZIPDIRENTRY_NAME(dir);
+				if (!strncmp(name, namePtr, nameSize) && !name[nameSize]
+					&& (isClass == ((dir->zipFileOffset & ISCLASS_BIT) != 0))
+				) {
+					return (UDATA *)dir;
+				}
+			} else {
+				J9ZipFileEntry *file = (J9ZipFileEntry *)entry;
+				if ((file->nameLength == nameSize) && !memcmp(J9ZIPFILEENTRY_NAME(file), namePtr, nameSize)
+					&& (isClass == ((file->zipFileOffset & ISCLASS_BIT) != 0))
+				) {
+					return (UDATA *)file;
+				}
+			}
+		}
+		i = (i + 1) & mask;
+	}
+	return NULL;
+}
+
+
+
+/* Frees the index of a cache which has not been copied to shared memory. */
+
+static void
+zipCache_freeIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	J9ZipIndexSlot *slots = ZIP_SRP_GET(zce->index, J9ZipIndexSlot *);
+
+	if (slots) {
+		ZIP_SRP_SET_TO_NULL(zce->index);
+		zce->indexSlotCount = 0;
+		j9mem_free_memory(slots);
+	}
+}
+
 #endif /* J9VM_OPT_ZIP_SUPPORT */ /* End File Level Build Flags */
@@ -233,14 +233,16 @@ static I_32 inflateData(struct workBuffer* workBuf, U_8* inputBuffer, U_32 input
 	if(err != Z_OK)
 		return -1;
 
-	/* Inflate the data. */
-	err = inflateFunc(&stream, Z_SYNC_FLUSH);
+	/* Inflate the data in a single call. The output buffer holds the whole entry, so
+		Z_FINISH lets zlib skip allocating the sliding window and copying the output into it. */
+	err = inflateFunc(&stream, Z_FINISH);
 
 	/* Clean up the stream. */
 	inflateEndFunc(&stream);
 
-	/* Check the return code. Did we complete the inflate? */
-	if((err == Z_STREAM_END)||(err == Z_OK)) {
+	/* Check the return code. Did we complete the inflate? Z_BUF_ERROR is returned
+		for a full output buffer when the end of the stream has not been read yet. */
+	if((err == Z_STREAM_END)||(err == Z_OK)||(err == Z_BUF_ERROR)) {
 		if(stream.total_out == outputBufferSize) {
 			return 0;
 		}
@@ -249,6 +251,7 @@ static I_32 inflateData(struct workBuffer* workBuf, U_8* inputBuffer, U_32 input
 	switch (err)  {
 	case Z_OK:  /* an error if file is incomplete */
 	case Z_STREAM_END:  /* an error if file is incomplete */
+	case Z_BUF_ERROR:  /* input is incomplete */
 	case Z_ERRNO:  /* a random error */
 	case Z_STREAM_ERROR:  /* stream inconsistent */
 	case Z_DATA_ERROR:  /* corrupted zip */
@@ -261,7 +264,6 @@ static I_32 inflateData(struct workBuffer* workBuf, U_8* inputBuffer, U_32 input
 	case Z_MEM_ERROR:  /* out of memory */
 		return ZIP_ERR_OUT_OF_MEMORY;
 
-	case Z_BUF_ERROR:  /* no progress / out of output buffer */
 	default:  /* jic */
 		return ZIP_ERR_INTERNAL_ERROR;
 	}
@@ -1429,6 +1431,9 @@ zip_readCacheData(J9PortLibrary * portLib, J9ZipFile *zipFile)
 		startCentralDir = (IDATA)((UDATA)endEntry.dirOffset);
 		zipCache_setStartCentralDir(zipFile->cache, startCentralDir);
 		result = zip_populateCache(portLib, zipFile, &endEntry, startCentralDir);
+		if (0 == result) {
+			zipCache_buildIndex(zipFile->cache);
+		}
 	}
 
 finished:
@@ -12,6 +12,15 @@
 #  pragma message("Assembler code may have bugs -- use at your own risk")
 #else
 
+/* Source is modified from the original zlib version to copy matches from the
+   output in chunks of INFLATE_CHUNK_SIZE bytes. A chunk never overlaps the
+   bytes it is copied from when the match distance is at least the chunk size,
+   and the copy may write up to INFLATE_CHUNK_SIZE - 1 bytes past the end of
+   the match, so it is only done when that much output space is available. */
+#ifndef INFLATE_CHUNK_SIZE
+#  define INFLATE_CHUNK_SIZE 8
+#endif
+
 /*
    Decode literal, length, and distance codes and write out the resulting
    literal and match bytes until either not enough input or output is
@@ -250,6 +259,19 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                 }
                 else {
                     from = out - dist;          /* copy direct from output */
+#if INFLATE_CHUNK_SIZE > 0
+                    if (dist >= INFLATE_CHUNK_SIZE &&
+                        len < (unsigned)(end - out) + 257 - (INFLATE_CHUNK_SIZE - 1)) {
+                        unsigned char FAR *stop = out + len;
+                        do {
+                            zmemcpy(out, from, INFLATE_CHUNK_SIZE);
+                            out += INFLATE_CHUNK_SIZE;
+                            from += INFLATE_CHUNK_SIZE;
+                        } while (out < stop);
+                        out = stop;
+                        continue;
+                    }
+#endif
                     do {                        /* minimum length is three */
                         *out++ = *from++;
                         *out++ = *from++;
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package jit.test.vich;
+
+import java.lang.management.ManagementFactory;
+import java.util.List;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+import org.testng.log4testng.Logger;
+import jit.test.vich.utils.Timer;
+
+/**
+ * Compares calls of static primitive-only natives through JNI with calls of the same natives which also
+ * have a JavaCritical_ entrypoint.  With -XX:+CriticalJNINatives, compiled code calls the critical entrypoint
+ * directly, without the JNIEnv, the class and the JNI transition.  Both entrypoints must return the same result.
+ * The JavaCritical_ entrypoints count their calls, so the test checks that they are used if and only if
+ * the JIT is enabled together with -XX:+CriticalJNINatives.
+ */
+public class JNICritical {
+	private static Logger logger = Logger.getLogger(JNICritical.class);
+	Timer timer;
+
+	static {
+		try {
+			System.loadLibrary("j9ben");
+		} catch (UnsatisfiedLinkError e) {}
+	}
+
+	static final int loopCount = 1000000;
+
+	public JNICritical() {
+		timer = new Timer();
+	}
+
+	static native int addJNI(int p1, int p2);
+	static native int addCritical(int p1, int p2);
+	static native long mixJNI(long p1, long p2, int p3, double p4);
+	static native long mixCritical(long p1, long p2, int p3, double p4);
+	static native long getCriticalCallCount();
+
+	/* The interpreter always calls natives through JNI, only compiled code calls the critical entrypoints */
+	static boolean isCriticalEntrypointExpected() {
+		List<String> arguments = ManagementFactory.getRuntimeMXBean().getInputArguments();
+		boolean enabled = false;
+		for (String argument : arguments) {
+			if (argument.equals("-Xint")) {
+				return false;
+			} else if (argument.equals("-XX:+CriticalJNINatives")) {
+				enabled = true;
+			} else if (argument.equals("-XX:-CriticalJNINatives")) {
+				enabled = false;
+			}
+		}
+		return enabled;
+	}
+
+	static long mix(long p1, long p2, int p3, double p4) {
+		long result = (p1 ^ (p2 << 7)) + p3;
+		return (result * 31) + (long)p4;
+	}
+
+	int addLoopJNI(int count) {
+		int sum = 0;
+		for (int i = 0; i < count; i++) {
+			sum = addJNI(sum, i);
+		}
+		return sum;
+	}
+
+	int addLoopCritical(int count) {
+		int sum = 0;
+		for (int i = 0; i < count; i++) {
+			sum = addCritical(sum, i);
+		}
+		return sum;
+	}
+
+	long mixLoopJNI(int count) {
+		long sum = 0;
+		for (int i = 0; i < count; i++) {
+			sum = mixJNI(sum, i, i, 0.5);
+		}
+		return sum;
+	}
+
+	long mixLoopCritical(int count) {
+		long sum = 0;
+		for (int i = 0; i < count; i++) {
+			sum = mixCritical(sum, i, i, 0.5);
+		}
+		return sum;
+	}
+
+	@Test(groups = { "level.sanity","component.jit" })
+	public void testJNICritical() {
+		try {
+			addJNI(1, 2);
+			addCritical(1, 2);
+		} catch (UnsatisfiedLinkError e) {
+			Assert.fail("No natives for JNI tests");
+		}
+
+		/* warm up, so that the loops get compiled with the natives called from compiled code */
+		for (int i = 0; i < 10; i++) {
+			Assert.assertEquals(addLoopCritical(loopCount / 10), addLoopJNI(loopCount / 10));
+			Assert.assertEquals(mixLoopCritical(loopCount / 10), mixLoopJNI(loopCount / 10));
+		}
+		Assert.assertEquals(addCritical(Integer.MAX_VALUE, 1), Integer.MIN_VALUE);
+		Assert.assertEquals(mixCritical(-1L, 3L, 5, 2.5), mix(-1L, 3L, 5, 2.5));
+
+		long criticalCalls = getCriticalCallCount();
+		logger.info("JavaCritical_ entrypoints called " + criticalCalls + " times");
+		if (isCriticalEntrypointExpected()) {
+			Assert.assertTrue(criticalCalls > 0, "the JavaCritical_ entrypoints were never called from compiled code");
+		} else {
+			Assert.assertEquals(criticalCalls, 0L, "the JavaCritical_ entrypoints must only be called with the JIT and -XX:+CriticalJNINatives");
+		}
+
+		timer.reset();
+		addLoopJNI(loopCount);
+		timer.mark();
+		logger.info(loopCount + " JNI calls of addJNI(II)I = " + timer.delta());
+		timer.reset();
+		addLoopCritical(loopCount);
+		timer.mark();
+		logger.info(loopCount + " calls of addCritical(II)I = " + timer.delta());
+
+		timer.reset();
+		mixLoopJNI(loopCount);
+		timer.mark();
+		logger.info(loopCount + " JNI calls of mixJNI(JJID)J = " + timer.delta());
+		timer.reset();
+		mixLoopCritical(loopCount);
+		timer.mark();
+		logger.info(loopCount + " calls of mixCritical(JJID)J = " + timer.delta());
+	}
+}
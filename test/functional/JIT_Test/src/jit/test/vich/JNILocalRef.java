@@ -1,5 +1,5 @@
 /*******************************************************************************
- * Copyright (c) 2006, 2020 IBM Corp. and others
+ * Copyright (c) 2006, 2021 IBM Corp. and others
  *
  * This program and the accompanying materials are made available under
  * the terms of the Eclipse Public License 2.0 which accompanies this
@@ -54,6 +54,7 @@ public class JNILocalRef {
 	static final int loopCount = 100000;
 	
 	public native void localReference8(Object o1, Object o2, Object o3, Object o4, Object o5, Object o6, Object o7, Object o8, int n);
+	public native void localFrame(Object o1, int capacity, int loopCount);
 	public native void localReference32(Object o1, Object o2, Object o3, Object o4, Object o5, Object o6, Object o7, Object o8, Object o9, Object o10, Object o11, Object o12, Object o13, Object o14, Object o15, Object o16, Object o17, Object o18, Object o19, Object o20, Object o21, Object o22, Object o23, Object o24, Object o25, Object o26, Object o27, Object o28, Object o29, Object o30, Object o31, Object o32, int loopCount);
 	
 	@Test(groups = { "level.sanity","component.jit" })
@@ -96,6 +97,7 @@ public class JNILocalRef {
 		{
 			localReference8(o1, o2, o3, o4, o5, o6, o7, o8, 1);
 			localReference32(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, 1);
+			localFrame(o1, 16, 1);
 		} catch (UnsatisfiedLinkError e) {
 			Assert.fail("No natives for JNI tests");
 		}
@@ -109,5 +111,18 @@ public class JNILocalRef {
 		localReference32(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, loopCount);
 		timer.mark();
 		logger.info(loopCount + " New/DeleteLocalRef calls (on 2x32 objects) = " + timer.delta());
+
+		timer.reset();
+		localFrame(o1, 16, loopCount);
+		timer.mark();
+		logger.info(loopCount + " Push/PopLocalFrame calls (16 refs per frame) = " + timer.delta());
+
+		/* each call overflows the local refs of the native method frame into a reference frame */
+		timer.reset();
+		for (int i = 0; i < loopCount; i++) {
+			localReference32(o1, o2, o3, o4, o5, o6, o7, o8, o9, o10, o11, o12, o13, o14, o15, o16, o17, o18, o19, o20, o21, o22, o23, o24, o25, o26, o27, o28, o29, o30, o31, o32, 1);
+		}
+		timer.mark();
+		logger.info(loopCount + " native calls with EnsureLocalCapacity(32) = " + timer.delta());
 	}
 }
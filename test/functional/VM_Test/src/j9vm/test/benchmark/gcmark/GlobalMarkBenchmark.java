@@ -0,0 +1,104 @@
+package j9vm.test.benchmark.gcmark;
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+
+/**
+ * Measures the time of explicit global collections over a live object graph whose shape is hard to
+ * balance between GC threads: a few long linked lists, which a marking thread can only follow one
+ * object at a time, next to a wide tree, which splits easily. Run it with the balanced policy and
+ * several GC threads, with and without -XXgc:markWorkStealing, and compare the average times.
+ *
+ * Usage: GlobalMarkBenchmark <number of list nodes, in thousands> <number of collections>
+ */
+public class GlobalMarkBenchmark {
+	static final int LIST_COUNT = 8;
+	static final int TREE_FANOUT = 8;
+
+	static final class Node {
+		Object next;
+		Object[] children;
+	}
+
+	public static void main(String[] args) {
+		if (args.length < 2) {
+			System.out.println("ERROR: Missing required argument !");
+			System.out.println("	First argument is the number of list nodes, in thousands");
+			System.out.println("	Second argument is the number of collections");
+			return;
+		}
+		int nodes = Integer.parseInt(args[0]) * 1000;
+		int collections = Integer.parseInt(args[1]);
+
+		Object[] roots = new Object[LIST_COUNT + 1];
+		for (int i = 0; i < LIST_COUNT; i++) {
+			roots[i] = buildList(nodes / LIST_COUNT);
+		}
+		roots[LIST_COUNT] = buildTree(nodes);
+
+		/* the first collection moves the graph out of the nursery and is not counted */
+		System.gc();
+		long totalNanos = 0;
+		for (int i = 0; i < collections; i++) {
+			long startTime = System.nanoTime();
+			System.gc();
+			totalNanos += System.nanoTime() - startTime;
+		}
+
+		System.out.println("List and tree nodes: " + (2 * nodes) + " average global collection time (us): " + (totalNanos / Math.max(collections, 1) / 1000));
+		if (roots[0] == null) {
+			System.out.println("ERROR: graph was not kept alive");
+		}
+	}
+
+	static Node buildList(int length) {
+		Node head = null;
+		for (int i = 0; i < length; i++) {
+			Node node = new Node();
+			node.next = head;
+			head = node;
+		}
+		return head;
+	}
+
+	static Node buildTree(int size) {
+		Node root = new Node();
+		Node[] level = new Node[] { root };
+		int built = 1;
+		while (built < size) {
+			Node[] nextLevel = new Node[level.length * TREE_FANOUT];
+			int count = 0;
+			for (int i = 0; (i < level.length) && (built < size); i++) {
+				level[i].children = new Object[TREE_FANOUT];
+				for (int j = 0; (j < TREE_FANOUT) && (built < size); j++) {
+					Node child = new Node();
+					level[i].children[j] = child;
+					nextLevel[count++] = child;
+					built += 1;
+				}
+			}
+			Node[] trimmed = new Node[count];
+			System.arraycopy(nextLevel, 0, trimmed, 0, count);
+			level = trimmed;
+		}
+		return root;
+	}
+}
@@ -0,0 +1,81 @@
+package j9vm.test.benchmark.interpreter;
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * Measures the time spent running short, cold methods in the interpreter, as a batch job does
+ * before (or without) the JIT compiling its methods. The work is dominated by field loads and
+ * long and double compares followed by branches. Run it with and without -Xint, and against an
+ * earlier build, to compare the interpreted and the warm-up times.
+ *
+ * Usage: InterpreterStartupBenchmark <number of iterations>
+ */
+public class InterpreterStartupBenchmark {
+	long limit;
+	double threshold;
+	long[] values;
+
+	InterpreterStartupBenchmark(int size) {
+		limit = size / 2;
+		threshold = size / 3.0;
+		values = new long[size];
+		for (int i = 0; i < size; i++) {
+			values[i] = (i * 31L) % size;
+		}
+	}
+
+	public static void main(String[] args) {
+		if (args.length < 1) {
+			System.out.println("ERROR: Missing required argument !");
+			System.out.println("	First argument is the number of iterations");
+			return;
+		}
+		int iterations = Integer.parseInt(args[0]);
+
+		long startTime = System.nanoTime();
+		long result = 0;
+		for (int i = 0; i < iterations; i++) {
+			result += new InterpreterStartupBenchmark(1000).run();
+		}
+		long endTime = System.nanoTime();
+		System.out.println("Result: " + result + " time (ms): " + ((endTime - startTime) / 1000000L));
+	}
+
+	long run() {
+		long count = 0;
+		for (int i = 0; i < values.length; i++) {
+			long value = values[i];
+			if (value < limit) {
+				count += 1;
+			}
+			if ((double)value >= threshold) {
+				count += 2;
+			}
+			if (value == limit) {
+				count -= 1;
+			}
+		}
+		return count;
+	}
+}
@@ -0,0 +1,337 @@
+package j9vm.test.benchmark.methodlookup;
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+import java.lang.invoke.MethodHandles;
+import java.lang.invoke.MethodType;
+
+/**
+ * Measures the rate of method lookups by name and signature in a class with many methods,
+ * and in the superclass of that class.
+ *
+ * Usage: MethodLookupBenchmark <number of lookups>
+ */
+public class MethodLookupBenchmark {
+	static final int METHOD_COUNT = 256;
+
+	public static void main(String[] args) throws Throwable {
+		if (args.length < 1) {
+			System.out.println("ERROR: Missing required argument !");
+			System.out.println("	First argument is the number of lookups to perform");
+			return;
+		}
+		long lookups = Long.parseLong(args[0]);
+
+		String[] names = new String[METHOD_COUNT];
+		for (int i = 0; i < METHOD_COUNT; i++) {
+			names[i] = "m" + i;
+		}
+		MethodHandles.Lookup lookup = MethodHandles.lookup();
+		MethodType type = MethodType.methodType(int.class);
+
+		/* warm up the lookup path */
+		for (int i = 0; i < METHOD_COUNT; i++) {
+			lookup.findVirtual(ManyMethods.class, names[i], type);
+		}
+
+		long startTime = System.nanoTime();
+		for (long i = 0; i < lookups; i++) {
+			lookup.findVirtual(ManyMethods.class, names[(int)(i % METHOD_COUNT)], type);
+		}
+		long endTime = System.nanoTime();
+		report("declared methods", lookups, endTime - startTime);
+
+		startTime = System.nanoTime();
+		for (long i = 0; i < lookups; i++) {
+			lookup.findVirtual(ManyMethodsSubclass.class, names[(int)(i % METHOD_COUNT)], type);
+		}
+		endTime = System.nanoTime();
+		report("inherited methods", lookups, endTime - startTime);
+	}
+
+	static void report(String what, long lookups, long nanos) {
+		System.out.println("Lookups of " + what + " per second: " + ((lookups * 1000000000L) / Math.max(nanos, 1)));
+	}
+
+	static class ManyMethodsSubclass extends ManyMethods {
+	}
+
+	static class ManyMethods {
+		public int m0() { return 0; }
+		public int m1() { return 1; }
+		public int m2() { return 2; }
+		public int m3() { return 3; }
+		public int m4() { return 4; }
+		public int m5() { return 5; }
+		public int m6() { return 6; }
+		public int m7() { return 7; }
+		public int m8() { return 8; }
+		public int m9() { return 9; }
+		public int m10() { return 10; }
+		public int m11() { return 11; }
+		public int m12() { return 12; }
+		public int m13() { return 13; }
+		public int m14() { return 14; }
+		public int m15() { return 15; }
+		public int m16() { return 16; }
+		public int m17() { return 17; }
+		public int m18() { return 18; }
+		public int m19() { return 19; }
+		public int m20() { return 20; }
+		public int m21() { return 21; }
+		public int m22() { return 22; }
+		public int m23() { return 23; }
+		public int m24() { return 24; }
+		public int m25() { return 25; }
+		public int m26() { return 26; }
+		public int m27() { return 27; }
+		public int m28() { return 28; }
+		public int m29() { return 29; }
+		public int m30() { return 30; }
+		public int m31() { return 31; }
+		public int m32() { return 32; }
+		public int m33() { return 33; }
+		public int m34() { return 34; }
+		public int m35() { return 35; }
+		public int m36() { return 36; }
+		public int m37() { return 37; }
+		public int m38() { return 38; }
+		public int m39() { return 39; }
+		public int m40() { return 40; }
+		public int m41() { return 41; }
+		public int m42() { return 42; }
+		public int m43() { return 43; }
+		public int m44() { return 44; }
+		public int m45() { return 45; }
+		public int m46() { return 46; }
+		public int m47() { return 47; }
+		public int m48() { return 48; }
+		public int m49() { return 49; }
+		public int m50() { return 50; }
+		public int m51() { return 51; }
+		public int m52() { return 52; }
+		public int m53() { return 53; }
+		public int m54() { return 54; }
+		public int m55() { return 55; }
+		public int m56() { return 56; }
+		public int m57() { return 57; }
+		public int m58() { return 58; }
+		public int m59() { return 59; }
+		public int m60() { return 60; }
+		public int m61() { return 61; }
+		public int m62() { return 62; }
+		public int m63() { return 63; }
+		public int m64() { return 64; }
+		public int m65() { return 65; }
+		public int m66() { return 66; }
+		public int m67() { return 67; }
+		public int m68() { return 68; }
+		public int m69() { return 69; }
+		public int m70() { return 70; }
+		public int m71() { return 71; }
+		public int m72() { return 72; }
+		public int m73() { return 73; }
+		public int m74() { return 74; }
+		public int m75() { return 75; }
+		public int m76() { return 76; }
+		public int m77() { return 77; }
+		public int m78() { return 78; }
+		public int m79() { return 79; }
+		public int m80() { return 80; }
+		public int m81() { return 81; }
+		public int m82() { return 82; }
+		public int m83() { return 83; }
+		public int m84() { return 84; }
+		public int m85() { return 85; }
+		public int m86() { return 86; }
+		public int m87() { return 87; }
+		public int m88() { return 88; }
+		public int m89() { return 89; }
+		public int m90() { return 90; }
+		public int m91() { return 91; }
+		public int m92() { return 92; }
+		public int m93() { return 93; }
+		public int m94() { return 94; }
+		public int m95() { return 95; }
+		public int m96() { return 96; }
+		public int m97() { return 97; }
+		public int m98() { return 98; }
+		public int m99() { return 99; }
+		public int m100() { return 100; }
+		public int m101() { return 101; }
+		public int m102() { return 102; }
+		public int m103() { return 103; }
+		public int m104() { return 104; }
+		public int m105() { return 105; }
+		public int m106() { return 106; }
+		public int m107() { return 107; }
+		public int m108() { return 108; }
+		public int m109() { return 109; }
+		public int m110() { return 110; }
+		public int m111() { return 111; }
+		public int m112() { return 112; }
+		public int m113() { return 113; }
+		public int m114() { return 114; }
+		public int m115() { return 115; }
+		public int m116() { return 116; }
+		public int m117() { return 117; }
+		public int m118() { return 118; }
+		public int m119() { return 119; }
+		public int m120() { return 120; }
+		public int m121() { return 121; }
+		public int m122() { return 122; }
+		public int m123() { return 123; }
+		public int m124() { return 124; }
+		public int m125() { return 125; }
+		public int m126() { return 126; }
+		public int m127() { return 127; }
+		public int m128() { return 128; }
+		public int m129() { return 129; }
+		public int m130() { return 130; }
+		public int m131() { return 131; }
+		public int m132() { return 132; }
+		public int m133() { return 133; }
+		public int m134() { return 134; }
+		public int m135() { return 135; }
+		public int m136() { return 136; }
+		public int m137() { return 137; }
+		public int m138() { return 138; }
+		public int m139() { return 139; }
+		public int m140() { return 140; }
+		public int m141() { return 141; }
+		public int m142() { return 142; }
+		public int m143() { return 143; }
+		public int m144() { return 144; }
+		public int m145() { return 145; }
+		public int m146() { return 146; }
+		public int m147() { return 147; }
+		public int m148() { return 148; }
+		public int m149() { return 149; }
+		public int m150() { return 150; }
+		public int m151() { return 151; }
+		public int m152() { return 152; }
+		public int m153() { return 153; }
+		public int m154() { return 154; }
+		public int m155() { return 155; }
+		public int m156() { return 156; }
+		public int m157() { return 157; }
+		public int m158() { return 158; }
+		public int m159() { return 159; }
+		public int m160() { return 160; }
+		public int m161() { return 161; }
+		public int m162() { return 162; }
+		public int m163() { return 163; }
+		public int m164() { return 164; }
+		public int m165() { return 165; }
+		public int m166() { return 166; }
+		public int m167() { return 167; }
+		public int m168() { return 168; }
+		public int m169() { return 169; }
+		public int m170() { return 170; }
+		public int m171() { return 171; }
+		public int m172() { return 172; }
+		public int m173() { return 173; }
+		public int m174() { return 174; }
+		public int m175() { return 175; }
+		public int m176() { return 176; }
+		public int m177() { return 177; }
+		public int m178() { return 178; }
+		public int m179() { return 179; }
+		public int m180() { return 180; }
+		public int m181() { return 181; }
+		public int m182() { return 182; }
+		public int m183() { return 183; }
+		public int m184() { return 184; }
+		public int m185() { return 185; }
+		public int m186() { return 186; }
+		public int m187() { return 187; }
+		public int m188() { return 188; }
+		public int m189() { return 189; }
+		public int m190() { return 190; }
+		public int m191() { return 191; }
+		public int m192() { return 192; }
+		public int m193() { return 193; }
+		public int m194() { return 194; }
+		public int m195() { return 195; }
+		public int m196() { return 196; }
+		public int m197() { return 197; }
+		public int m198() { return 198; }
+		public int m199() { return 199; }
+		public int m200() { return 200; }
+		public int m201() { return 201; }
+		public int m202() { return 202; }
+		public int m203() { return 203; }
+		public int m204() { return 204; }
+		public int m205() { return 205; }
+		public int m206() { return 206; }
+		public int m207() { return 207; }
+		public int m208() { return 208; }
+		public int m209() { return 209; }
+		public int m210() { return 210; }
+		public int m211() { return 211; }
+		public int m212() { return 212; }
+		public int m213() { return 213; }
+		public int m214() { return 214; }
+		public int m215() { return 215; }
+		public int m216() { return 216; }
+		public int m217() { return 217; }
+		public int m218() { return 218; }
+		public int m219() { return 219; }
+		public int m220() { return 220; }
+		public int m221() { return 221; }
+		public int m222() { return 222; }
+		public int m223() { return 223; }
+		public int m224() { return 224; }
+		public int m225() { return 225; }
+		public int m226() { return 226; }
+		public int m227() { return 227; }
+		public int m228() { return 228; }
+		public int m229() { return 229; }
+		public int m230() { return 230; }
+		public int m231() { return 231; }
+		public int m232() { return 232; }
+		public int m233() { return 233; }
+		public int m234() { return 234; }
+		public int m235() { return 235; }
+		public int m236() { return 236; }
+		public int m237() { return 237; }
+		public int m238() { return 238; }
+		public int m239() { return 239; }
+		public int m240() { return 240; }
+		public int m241() { return 241; }
+		public int m242() { return 242; }
+		public int m243() { return 243; }
+		public int m244() { return 244; }
+		public int m245() { return 245; }
+		public int m246() { return 246; }
+		public int m247() { return 247; }
+		public int m248() { return 248; }
+		public int m249() { return 249; }
+		public int m250() { return 250; }
+		public int m251() { return 251; }
+		public int m252() { return 252; }
+		public int m253() { return 253; }
+		public int m254() { return 254; }
+		public int m255() { return 255; }
+	}
+}
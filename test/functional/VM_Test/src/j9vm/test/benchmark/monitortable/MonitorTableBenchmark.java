@@ -0,0 +1,95 @@
+package j9vm.test.benchmark.monitortable;
+
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * Measures the rate of monitor enters when many threads lock distinct objects whose monitors live
+ * in the VM monitor table. Arrays have no lockword, so every enter looks the monitor up in the
+ * monitor table (after the per-thread lookup cache), and every newly locked array adds a table entry.
+ * Each thread locks its own set of arrays, which is larger than the per-thread lookup cache, and
+ * regularly replaces one of them with a new array, like per-request objects would.
+ *
+ * Usage: MonitorTableBenchmark <number of threads> <number of monitor enters per thread>
+ */
+public class MonitorTableBenchmark {
+	static final int LOCKS_PER_THREAD = 256;
+	static final int REPLACE_INTERVAL = 16;
+
+	public static void main(String[] args) throws Throwable {
+		if (args.length < 2) {
+			System.out.println("ERROR: Missing required argument !");
+			System.out.println("	First argument is the number of threads");
+			System.out.println("	Second argument is the number of monitor enters per thread");
+			return;
+		}
+		int threadCount = Integer.parseInt(args[0]);
+		final long enters = Long.parseLong(args[1]);
+
+		/* single threaded run first to warm up the lock path and to give a baseline */
+		run(1, enters);
+		run(threadCount, enters);
+	}
+
+	static void run(int threadCount, final long enters) throws InterruptedException {
+		Thread[] threads = new Thread[threadCount];
+		for (int i = 0; i < threadCount; i++) {
+			threads[i] = new Thread() {
+				public void run() {
+					lockMany(enters);
+				}
+			};
+		}
+
+		long startTime = System.nanoTime();
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].start();
+		}
+		for (int i = 0; i < threadCount; i++) {
+			threads[i].join();
+		}
+		long endTime = System.nanoTime();
+
+		long totalEnters = enters * threadCount;
+		System.out.println("Threads: " + threadCount + " monitor enters per second: " + ((totalEnters * 1000000000L) / Math.max(endTime - startTime, 1)));
+	}
+
+	static long lockMany(long enters) {
+		Object[] locks = new Object[LOCKS_PER_THREAD];
+		for (int i = 0; i < LOCKS_PER_THREAD; i++) {
+			locks[i] = new int[1];
+		}
+		long sum = 0;
+		for (long i = 0; i < enters; i++) {
+			int index = (int)(i % LOCKS_PER_THREAD);
+			if (0 == (i % REPLACE_INTERVAL)) {
+				locks[index] = new int[1];
+			}
+			int[] lock = (int[])locks[index];
+			synchronized (lock) {
+				lock[0] += 1;
+				sum += lock[0];
+			}
+		}
+		return sum;
+	}
+}
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.tests.garbagecollector;
+
+/**
+ * Allocates from a single site so that -XXgc:allocationSiteProfile reports it.
+ * Run with -Xjit:count=0,disableInlining so the site is in a compiled method of its own:
+ * the newarray in allocate() is at bytecode index 2.
+ */
+public class AllocationSiteProfile
+{
+	static final int ALLOCATIONS = 500000;
+
+	public static Object _objectHolder;
+
+	static byte[] allocate()
+	{
+		return new byte[64];
+	}
+
+	public static void main(String[] args)
+	{
+		for (int i = 0; i < ALLOCATIONS; i++) {
+			_objectHolder = allocate();
+		}
+		/* the allocation sites are reported at the end of a global mark */
+		System.gc();
+		System.out.println("Allocation site test complete");
+	}
+}
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (c) 2021, 2021 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+package com.ibm.jvmti.tests.asyncGetCallTrace;
+
+import java.util.concurrent.locks.LockSupport;
+
+public class agct001 {
+	static final int SAMPLE_INTERVAL_MICROS = 1000;
+	static final int WORKER_THREADS = 8;
+	static final int WORK_ITERATIONS = 200;
+
+	static volatile long sink;
+	static volatile boolean sampling;
+
+	public static native boolean isSupported();
+	public static native boolean startSampling(int intervalMicros);
+	public static native void stopSampling();
+	public static native int getSampleCount();
+	public static native int getWalkedCount();
+	public static native int getInvalidCount();
+	public static native int verifySamples();
+	public static native boolean jvmtiSample();
+
+	public String helpAsyncGetCallTrace() {
+		return "Sample the running threads with AsyncGetCallTrace from a SIGPROF handler and check that the stacks are walked";
+	}
+
+	public boolean testAsyncGetCallTrace() throws InterruptedException {
+		if (!isSupported()) {
+			System.out.println("AsyncGetCallTrace is not supported on this platform");
+			return true;
+		}
+		if (!startSampling(SAMPLE_INTERVAL_MICROS)) {
+			return false;
+		}
+		try {
+			runWorkers();
+		} finally {
+			stopSampling();
+		}
+		int samples = getSampleCount();
+		int walked = getWalkedCount();
+		int verified = verifySamples();
+		int invalid = getInvalidCount();
+		System.out.println("Samples: " + samples + " walked: " + walked + " method IDs verified: " + verified + " invalid: " + invalid);
+		return (samples > 0) && (walked > 0) && (verified > 0) && (0 == invalid);
+	}
+
+	public String helpSamplingOverhead() {
+		return "Compare the time taken by a workload when unsampled, sampled with AsyncGetCallTrace and sampled with JVMTI GetAllStackTraces";
+	}
+
+	public boolean testSamplingOverhead() throws InterruptedException {
+		if (!isSupported()) {
+			System.out.println("AsyncGetCallTrace is not supported on this platform");
+			return true;
+		}
+		/* warm up so the JIT compiles the workload before anything is timed */
+		runWorkers();
+
+		long unsampled = runWorkers();
+
+		if (!startSampling(SAMPLE_INTERVAL_MICROS)) {
+			return false;
+		}
+		long asyncSampled = 0;
+		try {
+			asyncSampled = runWorkers();
+		} finally {
+			stopSampling();
+		}
+
+		final boolean[] jvmtiFailed = new boolean[1];
+		sampling = true;
+		Thread sampler = new Thread() {
+			public void run() {
+				while (sampling) {
+					if (!jvmtiSample()) {
+						jvmtiFailed[0] = true;
+						break;
+					}
+					LockSupport.parkNanos(SAMPLE_INTERVAL_MICROS * 1000L);
+				}
+			}
+		};
+		sampler.start();
+		long jvmtiSampled = 0;
+		try {
+			jvmtiSampled = runWorkers();
+		} finally {
+			sampling = false;
+			sampler.join();
+		}
+
+		System.out.println("Workload time (ms) unsampled: " + (unsampled / 1000000L)
+				+ " AsyncGetCallTrace: " + (asyncSampled / 1000000L)
+				+ " GetAllStackTraces: " + (jvmtiSampled / 1000000L));
+		return !jvmtiFailed[0];
+	}
+
+	static long runWorkers() throws InterruptedException {
+		Thread[] workers = new Thread[WORKER_THREADS];
+		for (int i = 0; i < WORKER_THREADS; i++) {
+			workers[i] = new Thread() {
+				public void run() {
+					long sum = 0;
+					for (int j = 0; j < WORK_ITERATIONS; j++) {
+						sum += work(20, j);
+					}
+					sink += sum;
+				}
+			};
+		}
+		long startTime = System.nanoTime();
+		for (int i = 0; i < WORKER_THREADS; i++) {
+			workers[i].start();
+		}
+		for (int i = 0; i < WORKER_THREADS; i++) {
+			workers[i].join();
+		}
+		return System.nanoTime() - startTime;
+	}
+
+	/* recurse to give the samples some depth */
+	static long work(int depth, int seed) {
+		if (0 == depth) {
+			long value = seed;
+			for (int i = 0; i < 10000; i++) {
+				value = (value * 31) + i;
+			}
+			return value;
+		}
+		return work(depth - 1, seed) + 1;
+	}
+}